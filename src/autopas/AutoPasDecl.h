@@ -658,6 +658,57 @@ class AutoPas {
   void setVerletRebuildFrequency(unsigned int verletRebuildFrequency) {
     _verletRebuildFrequency = verletRebuildFrequency;
   }
+
+  /**
+   * Get the rebuild frequencies the tuner chooses from.
+   * @return
+   */
+  [[nodiscard]] const std::set<unsigned int> &getAllowedVerletRebuildFrequencies() const {
+    return _allowedVerletRebuildFrequencies;
+  }
+
+  /**
+   * Set the rebuild frequencies the tuner chooses from. This makes the rebuild frequency and with it the Verlet skin,
+   * which is the skin per timestep times the rebuild frequency, a dimension of the search space.
+   * All values have to be in [1, verletRebuildFrequency], so that the interaction length never exceeds the one given by
+   * getVerletSkin(). If empty, the rebuild frequency is not tuned.
+   * @param allowedVerletRebuildFrequencies
+   */
+  void setAllowedVerletRebuildFrequencies(const std::set<unsigned int> &allowedVerletRebuildFrequencies) {
+    _allowedVerletRebuildFrequencies = allowedVerletRebuildFrequencies;
+  }
+
+  /**
+   * Get the OpenMP thread counts the tuner chooses from.
+   * @return
+   */
+  [[nodiscard]] const std::set<unsigned int> &getAllowedThreadCounts() const { return _allowedThreadCounts; }
+
+  /**
+   * Set the OpenMP thread counts the tuner chooses from. This makes the number of threads that compute the
+   * interactions a dimension of the search space.
+   * All values have to be in [1, autopas_get_max_threads()]. If empty, all available threads are used.
+   * @param allowedThreadCounts
+   */
+  void setAllowedThreadCounts(const std::set<unsigned int> &allowedThreadCounts) {
+    _allowedThreadCounts = allowedThreadCounts;
+  }
+
+  /**
+   * Get the OpenMP chunk sizes the tuner chooses from.
+   * @return
+   */
+  [[nodiscard]] const std::set<unsigned int> &getAllowedChunkSizes() const { return _allowedChunkSizes; }
+
+  /**
+   * Set the chunk sizes of the dynamically scheduled traversal loops the tuner chooses from. This makes the chunk size
+   * a dimension of the search space. Traversals that do not schedule their loops dynamically ignore the chunk size and
+   * are only part of the search space once with the default.
+   * All values have to be at least 1. If empty, the traversals use a chunk size of 1.
+   * @param allowedChunkSizes
+   */
+  void setAllowedChunkSizes(const std::set<unsigned int> &allowedChunkSizes) { _allowedChunkSizes = allowedChunkSizes; }
+
   /**
    * Get Verlet cluster size.
    * @return
@@ -706,6 +757,132 @@ class AutoPas {
    */
   void setUseLOESSSmoothening(bool useLOESSSmoothening) { _autoTunerInfo.useLOESSSmoothening = useLOESSSmoothening; }
 
+  /**
+   * Get the factor by which a configuration may be slower than the best one of the current tuning phase before its
+   * remaining samples are skipped.
+   * @return
+   */
+  [[nodiscard]] double getEarlyStoppingFactor() const { return _autoTunerInfo.earlyStoppingFactor; }
+
+  /**
+   * Set the factor by which a configuration may be slower than the best one of the current tuning phase before its
+   * remaining samples are skipped. Infinity disables early stopping.
+   * @param earlyStoppingFactor
+   */
+  void setEarlyStoppingFactor(double earlyStoppingFactor) { _autoTunerInfo.earlyStoppingFactor = earlyStoppingFactor; }
+
+  /**
+   * Get the maximal number of samples per configuration for adaptive sampling.
+   * @return
+   */
+  [[nodiscard]] unsigned int getMaxAdaptiveSamples() const { return _autoTunerInfo.maxAdaptiveSamples; }
+
+  /**
+   * Set the maximal number of samples per configuration for adaptive sampling. If this is larger than the number of
+   * samples, configurations are sampled until their confidence interval separates them from the best configuration of
+   * the tuning phase or this number is reached. Zero disables adaptive sampling.
+   * @param maxAdaptiveSamples
+   */
+  void setMaxAdaptiveSamples(unsigned int maxAdaptiveSamples) {
+    _autoTunerInfo.maxAdaptiveSamples = maxAdaptiveSamples;
+  }
+
+  /**
+   * Get the relative slowdown compared to the fastest configuration that the tuning metric energyBoundedSlowdown
+   * accepts for lower energy consumption.
+   * @return
+   */
+  [[nodiscard]] double getMaxSlowdown() const { return _autoTunerInfo.maxSlowdown; }
+
+  /**
+   * Set the relative slowdown compared to the fastest configuration that the tuning metric energyBoundedSlowdown
+   * accepts for lower energy consumption. E.g. 0.05 selects the configuration with the least energy consumption among
+   * all configurations that are at most 5% slower than the fastest one.
+   * @param maxSlowdown
+   */
+  void setMaxSlowdown(double maxSlowdown) {
+    if (maxSlowdown < 0.) {
+      utils::ExceptionHandler::exception("Error: Max slowdown has to be non-negative but is {}!", maxSlowdown);
+    }
+    _autoTunerInfo.maxSlowdown = maxSlowdown;
+  }
+
+  /**
+   * Get the number of iterations between two exploration steps of continuous tuning. Zero means regular tuning phases.
+   * @return
+   */
+  [[nodiscard]] unsigned int getExplorationInterval() const { return _autoTunerInfo.explorationInterval; }
+
+  /**
+   * Set the number of iterations between two exploration steps of continuous tuning.
+   * If set to a value greater than zero, only the first tuning phase tests the whole search space and the tuning
+   * interval is ignored. Afterwards, the best known configuration is used and every explorationInterval iterations a
+   * single configuration is sampled. A new full tuning phase is only started if the runtime of the selected
+   * configuration drifts by more than the drift threshold.
+   * @param explorationInterval
+   */
+  void setExplorationInterval(unsigned int explorationInterval) {
+    _autoTunerInfo.explorationInterval = explorationInterval;
+  }
+
+  /**
+   * Get the relative runtime change of the selected configuration that starts a new tuning phase in continuous
+   * tuning or with retuning on drift.
+   * @return
+   */
+  [[nodiscard]] double getDriftThreshold() const { return _autoTunerInfo.driftThreshold; }
+
+  /**
+   * Set the relative runtime change of the selected configuration that starts a new tuning phase in continuous
+   * tuning or with retuning on drift.
+   * @param driftThreshold
+   */
+  void setDriftThreshold(double driftThreshold) { _autoTunerInfo.driftThreshold = driftThreshold; }
+
+  /**
+   * Get whether tuning phases are triggered by drift of the runtime or the particle distribution.
+   * @return
+   */
+  [[nodiscard]] bool getRetuneOnDrift() const { return _autoTunerInfo.retuneOnDrift; }
+
+  /**
+   * Set whether tuning phases are triggered by drift of the runtime or the particle distribution.
+   * If true, a new tuning phase starts as soon as the runtime of the selected configuration drifts by more than the
+   * drift threshold or the homogeneity or maximum density, which are checked at every neighbor list rebuild, drift by
+   * more than the scenario drift threshold. Regular tuning phases are postponed if nothing drifted.
+   * @param retuneOnDrift
+   */
+  void setRetuneOnDrift(bool retuneOnDrift) { _autoTunerInfo.retuneOnDrift = retuneOnDrift; }
+
+  /**
+   * Get the change of homogeneity or maximum density, relative to the maximum density, that counts as drift.
+   * @return
+   */
+  [[nodiscard]] double getScenarioDriftThreshold() const { return _autoTunerInfo.scenarioDriftThreshold; }
+
+  /**
+   * Set the change of homogeneity or maximum density, relative to the maximum density, that counts as drift.
+   * @param scenarioDriftThreshold
+   */
+  void setScenarioDriftThreshold(double scenarioDriftThreshold) {
+    _autoTunerInfo.scenarioDriftThreshold = scenarioDriftThreshold;
+  }
+
+  /**
+   * Get whether the selection of the optimum takes the cost of switching containers into account.
+   * @return
+   */
+  [[nodiscard]] bool getConsiderSwitchCosts() const { return _autoTunerInfo.considerSwitchCosts; }
+
+  /**
+   * Set whether the selection of the optimum takes the cost of switching containers into account.
+   * If true and the tuning metric is time, the configuration with the lowest expected time until the next tuning
+   * phase, including converting the particles to its container and rebuilding the neighbor lists, is selected. Hence, a
+   * slightly faster configuration is only chosen if it pays off its switch cost before the next tuning phase.
+   * @param considerSwitchCosts
+   */
+  void setConsiderSwitchCosts(bool considerSwitchCosts) { _autoTunerInfo.considerSwitchCosts = considerSwitchCosts; }
+
   /**
    * Get maximum number of evidence for tuning
    * @return
@@ -1020,6 +1197,22 @@ class AutoPas {
     _tuningStrategyFactoryInfo.mpiTuningWeightForMaxDensity = MPITuningWeightForMaxDensity;
   }
 
+  /**
+   * Getter for whether the ranks of a bucket share their evidence during MPI-tuning.
+   * @return
+   */
+  [[nodiscard]] bool getMPITuningShareEvidence() const { return _tuningStrategyFactoryInfo.mpiTuningShareEvidence; }
+
+  /**
+   * Setter for whether the ranks of a bucket share their evidence during MPI-tuning.
+   * If enabled, evidence is exchanged with non-blocking communication while the next configurations are sampled and
+   * all ranks of a bucket end the tuning phase by testing the best configuration of the bucket.
+   * @param MPITuningShareEvidence
+   */
+  void setMPITuningShareEvidence(bool MPITuningShareEvidence) {
+    _tuningStrategyFactoryInfo.mpiTuningShareEvidence = MPITuningShareEvidence;
+  }
+
 // Only define the interface for the MPI communicator if AUTOPAS_INCLUDE_MPI=ON
 // The internal implementation will use _autopasMPICommunicator with WrapMPI regardless of AUTOPAS_INCLUDE_MPI
 #if defined(AUTOPAS_INCLUDE_MPI)
@@ -1070,6 +1263,56 @@ class AutoPas {
    */
   const std::string &getRuleFileName() const { return _tuningStrategyFactoryInfo.ruleFileName; }
 
+  /**
+   * Set the file used by the TuningDatabase strategy to store and look up tuning results across runs.
+   * @param tuningDatabaseFileName
+   */
+  void setTuningDatabaseFileName(const std::string &tuningDatabaseFileName) {
+    _tuningStrategyFactoryInfo.tuningDatabaseFileName = tuningDatabaseFileName;
+  }
+
+  /**
+   * Get the file used by the TuningDatabase strategy.
+   * @return
+   */
+  const std::string &getTuningDatabaseFileName() const { return _tuningStrategyFactoryInfo.tuningDatabaseFileName; }
+
+  /**
+   * Set the maximal scenario distances for the TuningDatabase strategy.
+   * @param warmStartDistance Up to this distance the best known configurations are tested first.
+   * @param skipDistance Up to this distance the tuning phase is skipped and the best known configuration is used.
+   */
+  void setTuningDatabaseDistances(double warmStartDistance, double skipDistance) {
+    _tuningStrategyFactoryInfo.tuningDatabaseWarmStartDistance = warmStartDistance;
+    _tuningStrategyFactoryInfo.tuningDatabaseSkipDistance = skipDistance;
+  }
+
+  /**
+   * Set the log of TuningStrategyLogger the RegressionCostModel strategy is trained with before the first tuning
+   * phase.
+   * @param regressionCostModelTrainingLog
+   */
+  void setRegressionCostModelTrainingLog(const std::string &regressionCostModelTrainingLog) {
+    _tuningStrategyFactoryInfo.regressionCostModelTrainingLog = regressionCostModelTrainingLog;
+  }
+
+  /**
+   * Get the log the RegressionCostModel strategy is trained with.
+   * @return
+   */
+  const std::string &getRegressionCostModelTrainingLog() const {
+    return _tuningStrategyFactoryInfo.regressionCostModelTrainingLog;
+  }
+
+  /**
+   * Set the factor by which the prediction of the RegressionCostModel for a configuration may exceed the best
+   * prediction before the configuration is not tested.
+   * @param regressionCostModelPruneFactor
+   */
+  void setRegressionCostModelPruneFactor(double regressionCostModelPruneFactor) {
+    _tuningStrategyFactoryInfo.regressionCostModelPruneFactor = regressionCostModelPruneFactor;
+  }
+
   /**
    * Set the sorting-threshold for traversals that use the CellFunctor
    * If the sum of the number of particles in two cells is greater or equal to that value, the CellFunctor creates a
@@ -1084,6 +1327,112 @@ class AutoPas {
    */
   size_t getSortingThreshold() const { return _sortingThreshold; }
 
+  /**
+   * Set whether LinkedCells traversals that use the CellFunctor should sort the particles of each cell before loading
+   * the SoAs. SoAFunctorPair is then only called on windows of particles whose distance along the sorting dimension is
+   * within the cutoff. This only affects cell pairs above the sorting-threshold.
+   * @param useSortedSoAWindows
+   */
+  void setUseSortedSoAWindows(bool useSortedSoAWindows) { _useSortedSoAWindows = useSortedSoAWindows; }
+
+  /**
+   * Get whether sorted SoA windows are used.
+   * @return useSortedSoAWindows
+   */
+  bool getUseSortedSoAWindows() const { return _useSortedSoAWindows; }
+
+  /**
+   * Set the fraction of the domain volume on which configurations are timed during tuning.
+   * If smaller than 1, every candidate configuration is only computed on a copy of a subdomain in the center of the
+   * domain with a copy of the functor, and the measured time is extrapolated by the number of owned particles. The
+   * actual step is meanwhile computed with the configuration that was used before. If any candidate of a tuning phase
+   * can not be timed on the subdomain, all candidates of this phase are timed with full steps. This only affects the
+   * tuning metric time with copyable functors and without continuous tuning or retuning on drift.
+   * @param tuningSubdomainFraction Value in (0, 1].
+   */
+  void setTuningSubdomainFraction(double tuningSubdomainFraction) {
+    if (tuningSubdomainFraction <= 0. or tuningSubdomainFraction > 1.) {
+      utils::ExceptionHandler::exception("Error: Tuning subdomain fraction has to be in (0, 1] but is {}!",
+                                         tuningSubdomainFraction);
+    }
+    _logicHandlerInfo.tuningSubdomainFraction = tuningSubdomainFraction;
+  }
+
+  /**
+   * Get the fraction of the domain volume on which configurations are timed during tuning.
+   * @return tuningSubdomainFraction
+   */
+  double getTuningSubdomainFraction() const { return _logicHandlerInfo.tuningSubdomainFraction; }
+
+  /**
+   * Set whether the threads are split into two teams during tuning (experimental).
+   * In the first step of every candidate configuration, the first team computes the actual step with it while the
+   * second team samples a later candidate on a copy of the container. The forces computed on the copy are discarded.
+   * Both samples only use a part of the threads, so they are not used as evidence, and the step is repeated including
+   * its neighbor list rebuild. Their ratio only serves to skip later candidates that are estimated to exceed the early
+   * stopping factor times the best evidence. This only affects the tuning metric time with a finite early stopping
+   * factor and is not combined with tuning on subdomains.
+   * Costs: Every candidate that is sampled this way adds one iteration to the tuning phase, and each of these
+   * iterations copies the full container.
+   * @param tuningThreadTeams
+   */
+  void setTuningThreadTeams(bool tuningThreadTeams) { _logicHandlerInfo.tuningThreadTeams = tuningThreadTeams; }
+
+  /**
+   * Get whether the threads are split into two teams during tuning.
+   * @return tuningThreadTeams
+   */
+  bool getTuningThreadTeams() const { return _logicHandlerInfo.tuningThreadTeams; }
+
+  /**
+   * Set whether pairwise and triwise interactions are tuned jointly.
+   * The pairwise configurations are then rated by the cost of the whole step, and the triwise tuner only considers
+   * configurations that share the container of the selected pairwise configuration, so both interaction types use the
+   * same container and neighbor structure. This requires calling updateContainer() once per step.
+   * @param jointInteractionTuning
+   */
+  void setJointInteractionTuning(bool jointInteractionTuning) {
+    _logicHandlerInfo.jointInteractionTuning = jointInteractionTuning;
+  }
+
+  /**
+   * Get whether pairwise and triwise interactions are tuned jointly.
+   * @return jointInteractionTuning
+   */
+  bool getJointInteractionTuning() const { return _logicHandlerInfo.jointInteractionTuning; }
+
+  /**
+   * Set the number of previously used containers that are kept alive during tuning.
+   * Switching back to such a shadow container reuses its allocated cells and particle storage. All particles are still
+   * copied into it and its neighbor lists are rebuilt. Shadows are released when tuning ends or when they exceed the
+   * memory budget.
+   * @param numShadowContainers Zero disables shadow containers.
+   */
+  void setNumShadowContainers(size_t numShadowContainers) {
+    _logicHandlerInfo.numShadowContainers = numShadowContainers;
+  }
+
+  /**
+   * Get the number of previously used containers that are kept alive during tuning.
+   * @return numShadowContainers
+   */
+  size_t getNumShadowContainers() const { return _logicHandlerInfo.numShadowContainers; }
+
+  /**
+   * Set the maximal estimated memory that all shadow containers may occupy together.
+   * Each container estimates its memory from its particles, SoA buffers, cells, and neighbor lists.
+   * @param shadowContainerMemoryBudget Budget in bytes.
+   */
+  void setShadowContainerMemoryBudget(size_t shadowContainerMemoryBudget) {
+    _logicHandlerInfo.shadowContainerMemoryBudget = shadowContainerMemoryBudget;
+  }
+
+  /**
+   * Get the maximal estimated memory that all shadow containers may occupy together.
+   * @return shadowContainerMemoryBudget in bytes.
+   */
+  size_t getShadowContainerMemoryBudget() const { return _logicHandlerInfo.shadowContainerMemoryBudget; }
+
  private:
   autopas::ParticleContainerInterface<Particle> &getContainer();
 
@@ -1108,6 +1457,18 @@ class AutoPas {
    * Specifies after how many pair-wise traversals the neighbor lists are to be rebuild.
    */
   unsigned int _verletRebuildFrequency{20};
+  /**
+   * Rebuild frequencies the tuner chooses from. If empty, _verletRebuildFrequency is used.
+   */
+  std::set<unsigned int> _allowedVerletRebuildFrequencies{};
+  /**
+   * OpenMP thread counts the tuner chooses from. If empty, all available threads are used.
+   */
+  std::set<unsigned int> _allowedThreadCounts{};
+  /**
+   * OpenMP chunk sizes the tuner chooses from. If empty, the traversals' default is used.
+   */
+  std::set<unsigned int> _allowedChunkSizes{};
   /**
    * Strategy option for the auto tuner.
    * For possible tuning strategy choices see options::TuningStrategyOption::Value.
@@ -1177,6 +1538,10 @@ class AutoPas {
    * Number of particles in two cells from which sorting should be performed for traversal that use the CellFunctor
    */
   size_t _sortingThreshold{8};
+  /**
+   * Sort particles in cells before loading SoAs and process SoA cell pairs in windows.
+   */
+  bool _useSortedSoAWindows{false};
   /**
    * Helper function to reduce code duplication for all forms of addParticle while minimizing overhead through loops.
    * Triggers reserve() and provides a parallel loop with deliberate scheduling.
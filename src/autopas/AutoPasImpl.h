@@ -82,6 +82,7 @@ void AutoPas<Particle>::init() {
   }
 
   _logicHandlerInfo.sortingThreshold = _sortingThreshold;
+  _logicHandlerInfo.useSortedSoAWindows = _useSortedSoAWindows;
 
   // If an interval was given for the cell size factor, change it to the relevant values.
   // Don't modify _allowedCellSizeFactors to preserve the initial (type) information.
@@ -97,12 +98,40 @@ void AutoPas<Particle>::init() {
     }
   }();
 
+  // Larger rebuild frequencies would require a larger skin than the one the halo is built for.
+  for (const auto rebuildFrequency : _allowedVerletRebuildFrequencies) {
+    if (rebuildFrequency == 0 or rebuildFrequency > _verletRebuildFrequency) {
+      utils::ExceptionHandler::exception(
+          "AutoPas::init(): Allowed rebuild frequencies have to be in [1, verletRebuildFrequency = {}] but {} was "
+          "given.",
+          _verletRebuildFrequency, rebuildFrequency);
+    }
+  }
+  // Zero stands for _verletRebuildFrequency and keeps the configurations as they are without tuning it.
+  const auto rebuildFrequencies =
+      _allowedVerletRebuildFrequencies.empty() ? std::set<unsigned int>{0} : _allowedVerletRebuildFrequencies;
+
+  // More threads than available would oversubscribe the cores and a thread count of zero means all threads.
+  for (const auto threadCount : _allowedThreadCounts) {
+    if (threadCount == 0 or threadCount > static_cast<unsigned int>(autopas_get_max_threads())) {
+      utils::ExceptionHandler::exception(
+          "AutoPas::init(): Allowed thread counts have to be in [1, max threads = {}] but {} was given.",
+          autopas_get_max_threads(), threadCount);
+    }
+  }
+  if (_allowedChunkSizes.count(0) > 0) {
+    utils::ExceptionHandler::exception("AutoPas::init(): Allowed chunk sizes have to be at least 1.");
+  }
+  // Zero stands for the defaults and keeps the configurations as they are without tuning these dimensions.
+  const auto threadCounts = _allowedThreadCounts.empty() ? std::set<unsigned int>{0} : _allowedThreadCounts;
+  const auto chunkSizes = _allowedChunkSizes.empty() ? std::set<unsigned int>{0} : _allowedChunkSizes;
+
   // Create autotuners for each interaction type
   for (const auto &interactionType : _allowedInteractionTypeOptions) {
     const auto searchSpace = SearchSpaceGenerators::cartesianProduct(
         _allowedContainers, _allowedTraversals[interactionType], _allowedLoadEstimators,
         _allowedDataLayouts[interactionType], _allowedNewton3Options[interactionType], &cellSizeFactors,
-        interactionType);
+        interactionType, rebuildFrequencies, threadCounts, chunkSizes);
 
     AutoTuner::TuningStrategiesListType tuningStrategies;
     tuningStrategies.reserve(_tuningStrategyOptions.size());
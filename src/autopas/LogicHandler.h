@@ -5,10 +5,15 @@
  */
 
 #pragma once
+#include <algorithm>
 #include <atomic>
+#include <cmath>
+#include <exception>
 #include <limits>
 #include <memory>
 #include <optional>
+#include <set>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <vector>
@@ -63,23 +68,26 @@ class LogicHandler {
         _containerSelector(logicHandlerInfo.boxMin, logicHandlerInfo.boxMax, logicHandlerInfo.cutoff),
         _verletClusterSize(logicHandlerInfo.verletClusterSize),
         _sortingThreshold(logicHandlerInfo.sortingThreshold),
-        _iterationLogger(outputSuffix, std::any_of(autotuners.begin(), autotuners.end(),
-                                                   [](const auto &tuner) { return tuner.second->canMeasureEnergy(); })),
+        _iterationLogger(outputSuffix,
+                         std::any_of(autotuners.begin(), autotuners.end(),
+                                     [](const auto &tuner) { return tuner.second->canMeasureEnergy(); }),
+                         std::any_of(autotuners.begin(), autotuners.end(),
+                                     [](const auto &tuner) { return tuner.second->canMeasurePerfCounters(); })),
         _flopLogger(outputSuffix),
         _liveInfoLogger(outputSuffix),
         _bufferLocks(std::max(2, autopas::autopas_get_max_threads())) {
     using namespace autopas::utils::ArrayMath::literals;
 
+    _containerSelector.setShadowContainers(logicHandlerInfo.numShadowContainers,
+                                           logicHandlerInfo.shadowContainerMemoryBudget);
+
     // Initialize AutoPas with tuners for given interaction types
     for (const auto &[interactionType, tuner] : autotuners) {
       _interactionTypes.insert(interactionType);
 
       const auto configuration = tuner->getCurrentConfig();
       // initialize the container and make sure it is valid
-      const ContainerSelectorInfo containerSelectorInfo{
-          configuration.cellSizeFactor, _logicHandlerInfo.verletSkinPerTimestep, _neighborListRebuildFrequency,
-          _verletClusterSize, configuration.loadEstimator};
-      _containerSelector.selectContainer(configuration.container, containerSelectorInfo);
+      _containerSelector.selectContainer(configuration.container, makeContainerSelectorInfo(configuration));
       checkMinimalSize();
     }
 
@@ -161,11 +169,20 @@ class LogicHandler {
     bool doDataStructureUpdate = not neighborListsAreValid();
 
     if (_functorCalls > 0) {
+      // The step is complete, so its combined cost can be passed to the pairwise tuner.
+      if (useJointTuning()) {
+        passJointStepMeasurement();
+      }
       // Bump iteration counters for all autotuners
       for (const auto &[interactionType, autoTuner] : _autoTunerRefs) {
         const bool needsToWait = checkTuningStates(interactionType);
         autoTuner->bumpIterationCounters(needsToWait);
       }
+      // Shadow containers only pay off while tuning switches between containers.
+      if (std::none_of(_autoTunerRefs.begin(), _autoTunerRefs.end(),
+                       [](const auto &entry) { return entry.second->inTuningPhase(); })) {
+        _containerSelector.clearShadowContainers();
+      }
 
       // We will do a rebuild in this timestep
       if (not _neighborListsAreValid.load(std::memory_order_relaxed)) {
@@ -261,6 +278,8 @@ class LogicHandler {
 
     // Set this flag, s.t., the container is rebuilt!
     _neighborListsAreValid.store(false, std::memory_order_relaxed);
+    // Traversals that were not applicable in the old domain might be now and vice versa.
+    _checkedApplicabilityInteractionTypes.clear();
 
     return particlesNowOutside;
   }
@@ -564,6 +583,16 @@ class LogicHandler {
   [[nodiscard]] std::tuple<std::optional<std::unique_ptr<TraversalInterface>>, bool> isConfigurationApplicable(
       const Configuration &conf, Functor &functor, const InteractionTypeOption &interactionType);
 
+  /**
+   * Switch to the container of the given configuration.
+   *
+   * If the container type changes, the conversion is timed. If the configuration is then used for the step, this time
+   * is reported together with the neighbor list rebuild as cost of the switch to the tuner that selected it.
+   *
+   * @param conf
+   */
+  void switchContainer(const Configuration &conf);
+
   /**
    * Directly exchange the internal particle and halo buffers with the given vectors and update particle counters.
    *
@@ -662,15 +691,213 @@ class LogicHandler {
 
   /**
    * Gathers dynamic data from the domain if necessary and retrieves the next configuration to use.
+   *
+   * If tuning on subdomains is enabled, the configuration proposed by the tuner is timed via
+   * sampleConfigurationOnSubdomain() and the returned configuration is the one that was used for the previous step.
+   *
    * @tparam Functor
    * @param functor
    * @param interactionType
-   * @return
+   * @return tuple<configuration, traversal, stillTuning, sampledOnSubdomain> The last bool indicates that the tuner
+   * already received its measurement for this iteration.
    */
   template <class Functor>
-  std::tuple<Configuration, std::unique_ptr<TraversalInterface>, bool> selectConfiguration(
+  std::tuple<Configuration, std::unique_ptr<TraversalInterface>, bool, bool> selectConfiguration(
       Functor &functor, const InteractionTypeOption &interactionType);
 
+  /**
+   * Checks if candidate configurations of the given interaction type should be timed on a subdomain instead of a full
+   * step. This requires a subdomain fraction smaller than one and the tuning metric time. Tuners that compare full
+   * steps outside of tuning phases to their evidence, i.e. continuous tuning and retuning on drift, are excluded.
+   * @param interactionType
+   * @return True if sampleConfigurationOnSubdomain() should be used.
+   */
+  bool useSubdomainSampling(const InteractionTypeOption &interactionType) const {
+    const auto &autoTuner = *_autoTunerRefs.at(interactionType);
+    return _logicHandlerInfo.tuningSubdomainFraction < 1. and not useJointTuning() and
+           autoTuner.getTuningMetric() == TuningMetricOption::time and not autoTuner.tunesContinuously() and
+           not autoTuner.retunesOnDrift();
+  }
+
+  /**
+   * Decides once per tuning phase if the candidates of the given interaction type are timed on a subdomain, so that
+   * all candidates of a phase are measured the same way. This is the case if useSubdomainSampling() holds, the functor
+   * can be copied, and every candidate in the queue of the tuner can be timed on the subdomain.
+   * @tparam Functor
+   * @param functor
+   * @param interactionType
+   * @return True if the candidates of the current tuning phase are timed via sampleConfigurationOnSubdomain().
+   */
+  template <class Functor>
+  bool decideSubdomainSampling(Functor &functor, const InteractionTypeOption &interactionType);
+
+  /**
+   * Determines the box in the center of the domain on which candidates are timed.
+   * It covers tuningSubdomainFraction of the domain volume but is at least one interaction length wide.
+   * @return tuple<subdomainMin, subdomainMax>
+   */
+  [[nodiscard]] std::tuple<std::array<double, 3>, std::array<double, 3>> getTuningSubdomain() const {
+    using namespace autopas::utils::ArrayMath::literals;
+    const auto &container = _containerSelector.getCurrentContainer();
+    const auto boxLength = container.getBoxMax() - container.getBoxMin();
+    const auto boxCenter = container.getBoxMin() + boxLength * 0.5;
+    const auto lengthFraction = std::cbrt(_logicHandlerInfo.tuningSubdomainFraction);
+    std::array<double, 3> subdomainHalfLength{};
+    for (size_t dim = 0; dim < 3; ++dim) {
+      subdomainHalfLength[dim] =
+          0.5 * std::min(boxLength[dim], std::max(boxLength[dim] * lengthFraction, container.getInteractionLength()));
+    }
+    return {boxCenter - subdomainHalfLength, boxCenter + subdomainHalfLength};
+  }
+
+  /**
+   * Generates the traversal of the given configuration for a container that is not the current one.
+   * @tparam Functor
+   * @param conf
+   * @param functor
+   * @param container
+   * @return The traversal or nullopt if it is not applicable to the container.
+   */
+  template <class Functor>
+  std::optional<std::unique_ptr<TraversalInterface>> generateTraversalForContainer(
+      const Configuration &conf, Functor &functor, ParticleContainerInterface<Particle> &container) const;
+
+  /**
+   * Checks if the threads should be split into two teams to sample a second candidate configuration of the given
+   * interaction type next to the first step of every candidate. This requires at least two threads, the tuning metric
+   * time, and neither tuning on subdomains nor joint tuning.
+   * @param interactionType
+   * @return True if computeInteractionsWithSpeculativeSample() should be used.
+   */
+  bool useThreadTeamSampling(const InteractionTypeOption &interactionType) const {
+    return _logicHandlerInfo.tuningThreadTeams and autopas_get_max_threads() >= 2 and
+           not useSubdomainSampling(interactionType) and not useJointTuning() and
+           _autoTunerRefs.at(interactionType)->getTuningMetric() == TuningMetricOption::time;
+  }
+
+  /**
+   * Checks if pairwise and triwise interactions are tuned jointly. This requires the option and tuners for both
+   * interaction types.
+   *
+   * In joint tuning, the pairwise tuner rates its configurations by the cost of the whole step, i.e. of the
+   * interactions of both types. While it tunes, the triwise interactions are computed with a configuration that
+   * shares its container. Afterwards, the triwise tuner only tunes configurations that share the container of the
+   * selected pairwise configuration, so both interaction types use the same container and neighbor structure.
+   * Subdomain sampling and thread teams are not used, because they only measure one interaction type.
+   * @return True if interaction types are tuned jointly.
+   */
+  bool useJointTuning() const {
+    return _logicHandlerInfo.jointInteractionTuning and
+           _interactionTypes.count(InteractionTypeOption::pairwise) != 0 and
+           _interactionTypes.count(InteractionTypeOption::triwise) != 0;
+  }
+
+  /**
+   * Checks if two configurations can be computed on the same container without switching or rebuilding it.
+   * @param lhs
+   * @param rhs
+   * @return True if container and container parameters are identical.
+   */
+  bool sharesContainer(const Configuration &lhs, const Configuration &rhs) const {
+    return lhs.container == rhs.container and makeContainerSelectorInfo(lhs) == makeContainerSelectorInfo(rhs);
+  }
+
+  /**
+   * Reduces the measurements of an iteration to a sample of the given tuning metric.
+   * @param tuningMetric
+   * @param measurements
+   * @param numFLOPs Number of FLOPs of the iteration.
+   * @return Sample for the tuner.
+   */
+  static long tuningSample(const TuningMetricOption &tuningMetric, const IterationMeasurements &measurements,
+                           size_t numFLOPs);
+
+  /**
+   * Passes the combined measurements of all interaction types in the current step to the pairwise tuner, if it expects
+   * a sample, and resets them. Only used with joint tuning.
+   */
+  void passJointStepMeasurement();
+
+  /**
+   * Selects a triwise configuration that shares the container of the pairwise configuration that was computed last.
+   * Among all such configurations, the current one of the triwise tuner is preferred, then the one with the best
+   * evidence. Only used with joint tuning.
+   * @tparam Functor
+   * @param functor
+   * @return Configuration and its traversal or nullopt if no configuration of the triwise search space shares the
+   * container and is applicable.
+   */
+  template <class Functor>
+  std::optional<std::tuple<Configuration, std::unique_ptr<TraversalInterface>>> selectSharedTriwiseConfiguration(
+      Functor &functor);
+
+  /**
+   * Leaves all configurations that do not share the container of the selected pairwise configuration out of the tuning
+   * phases of the triwise tuner and starts a tuning phase for the remaining ones. If no configuration remains, the
+   * triwise tuner tunes without restriction. Only used with joint tuning.
+   * @tparam Functor
+   * @param functor
+   */
+  template <class Functor>
+  void restrictTriwiseTuningToSharedContainer(Functor &functor);
+
+  /**
+   * Times the given configuration on a copy of the subdomain from getTuningSubdomain() and passes the measurement,
+   * extrapolated by the number of owned particles, to the tuner.
+   *
+   * The sample covers initTraversal(), the neighbor list rebuild, computeInteractions(), and endTraversal() of a copy of
+   * the functor, so the state of the functor of the actual step is not touched. The neighbor lists of the copy are
+   * always built, however, the rebuild time only counts if the actual step also rebuilds its neighbor lists. The copy
+   * has no particle buffers, so there is no remainder traversal. All candidates of a tuning phase are measured like
+   * this, see decideSubdomainSampling().
+   *
+   * @tparam Functor
+   * @param conf
+   * @param functor
+   * @param interactionType
+   * @return tuple<sampled, rejectIndefinitely> sampled is false if the configuration is not applicable on the
+   * subdomain. rejectIndefinitely indicates that the configuration will never be applicable.
+   */
+  template <class Functor>
+  std::tuple<bool, bool> sampleConfigurationOnSubdomain(const Configuration &conf, Functor &functor,
+                                                        const InteractionTypeOption &interactionType);
+
+  /**
+   * Creates the info to select the container of the given configuration.
+   * The Verlet skin is the skin per timestep times the rebuild frequency of the configuration.
+   * @param conf
+   * @return
+   */
+  [[nodiscard]] ContainerSelectorInfo makeContainerSelectorInfo(const Configuration &conf) const {
+    const auto rebuildFrequency = conf.rebuildFrequency == 0 ? _neighborListRebuildFrequency : conf.rebuildFrequency;
+    return ContainerSelectorInfo{conf.cellSizeFactor, _logicHandlerInfo.verletSkinPerTimestep, rebuildFrequency,
+                                 _verletClusterSize, conf.loadEstimator};
+  }
+
+  /**
+   * Checks if the container of the given configuration supports its traversal and if the functor supports its
+   * Newton 3 mode. Configurations failing this check will never be applicable.
+   * @tparam Functor
+   * @param conf
+   * @param functor
+   * @return True if the configuration is compatible.
+   */
+  template <class Functor>
+  bool isConfigurationCompatible(const Configuration &conf, Functor &functor) const;
+
+  /**
+   * Determines all configurations of the given set that are not compatible with the functor or whose traversal is not
+   * applicable in the current domain. The traversals are checked on empty containers, so neither the current container
+   * nor any particles are touched. Traversals of containers whose structure depends on the particles are not checked.
+   * @tparam Functor
+   * @param configurations
+   * @param functor
+   * @return Set of configurations that can not be used.
+   */
+  template <class Functor>
+  std::set<Configuration> findInapplicableConfigurations(const std::set<Configuration> &configurations,
+                                                         Functor &functor);
+
   /**
    * Triggers the core steps of computing the particle interactions:
    *    - functor init- / end traversal
@@ -682,11 +909,42 @@ class LogicHandler {
    * @tparam Functor
    * @param functor
    * @param traversal
+   * @param configuration Configuration the traversal was generated for.
    * @return Struct containing time and energy measurements. If no energy measurements were possible the respective
    * fields are filled with NaN.
    */
   template <class Functor>
-  IterationMeasurements computeInteractions(Functor &functor, TraversalInterface &traversal);
+  IterationMeasurements computeInteractions(Functor &functor, TraversalInterface &traversal,
+                                            const Configuration &configuration);
+
+  /**
+   * Computes the actual step like computeInteractions() with one half of the threads while the other half samples the
+   * speculative configuration on a copy of the container.
+   *
+   * Both teams measure the same quantity: initTraversal(), the neighbor list rebuild, computeInteractions(), and
+   * endTraversal(). The remainder traversal of the actual step is left out, because the copy has no particle buffers.
+   * Since both samples are taken with only a part of the threads, neither of them is evidence. Instead, both are passed
+   * to AutoTuner::addSpeculativeMeasurement(), which only uses their ratio to skip hopeless candidates. Thread counts of
+   * the configurations are capped at the size of their team.
+   *
+   * This is only done in iterations that rebuild the neighbor lists, so the copy, which always builds its lists, is
+   * timed like the actual step. The copy works with its own copy of the functor, so its forces and functor statistics
+   * are discarded. If the speculative configuration can not be used on the copy, the step is computed with all threads
+   * and no speculative sample is taken. Otherwise, the tuner repeats the step including its rebuild, so the current
+   * configuration still gets a full set of samples. This costs one extra iteration and a copy of the full container.
+   *
+   * @tparam Functor
+   * @param functor
+   * @param traversal
+   * @param configuration Configuration the traversal was generated for.
+   * @param speculativeConfiguration Configuration that is sampled by the second team.
+   * @param interactionType
+   * @return tuple<measurements, sampled> Measurements of the actual step and if the speculative sample was taken.
+   */
+  template <class Functor>
+  std::tuple<IterationMeasurements, bool> computeInteractionsWithSpeculativeSample(
+      Functor &functor, TraversalInterface &traversal, const Configuration &configuration,
+      const Configuration &speculativeConfiguration, const InteractionTypeOption &interactionType);
 
   /**
    * Select the right Remainder function depending on the interaction type and newton3 setting.
@@ -907,6 +1165,57 @@ class LogicHandler {
    */
   unsigned int _stepsSinceLastListRebuild{0};
 
+  /**
+   * Configuration with which the interactions of each type were computed for the last full step.
+   * When tuning on subdomains, full steps are computed with these configurations.
+   */
+  std::unordered_map<InteractionTypeOption::Value, Configuration> _lastComputedConfigurations{};
+
+  /**
+   * Decision per interaction type if the candidates of the current tuning phase are timed on a subdomain.
+   * See decideSubdomainSampling().
+   */
+  std::unordered_map<InteractionTypeOption::Value, bool> _subdomainSamplingInPhase{};
+
+  /**
+   * Interaction types whose tuner knows which configurations are not applicable in the current domain.
+   */
+  std::set<InteractionTypeOption::Value> _checkedApplicabilityInteractionTypes{};
+
+  /**
+   * Configurations of each interaction type that were found to be not applicable in the current domain.
+   */
+  std::unordered_map<InteractionTypeOption::Value, std::set<Configuration>> _inapplicableConfigurations{};
+
+  /**
+   * Sum of the measurements of all interaction types in the current step. Only used with joint tuning.
+   */
+  IterationMeasurements _jointStepMeasurements{};
+
+  /**
+   * Sum of the FLOPs of all interaction types in the current step. Only used with joint tuning.
+   */
+  size_t _jointStepNumFLOPs{0};
+
+  /**
+   * If the pairwise tuner expects a sample for the current step: (rebuildIteration, stillTuning).
+   * Only used with joint tuning.
+   */
+  std::optional<std::tuple<bool, bool>> _jointStepSample{};
+
+  /**
+   * True if the pairwise tuner tuned since the triwise tuner was restricted to its container the last time.
+   * Only used with joint tuning.
+   */
+  bool _triwiseTuningNeedsRestriction{true};
+
+  /**
+   * Last container switch while selecting a configuration: (to, time of the conversion). Switches while probing
+   * configurations that are not used are overwritten. It is only reported if the selected configuration uses the
+   * target container, and the rebuild of the neighbor lists in the next iteration is added to the time before.
+   */
+  std::optional<std::tuple<ContainerOption, long>> _pendingContainerSwitch{};
+
   /**
    * Total number of functor calls of all interaction types.
    */
@@ -988,7 +1297,8 @@ bool LogicHandler<Particle>::neighborListsAreValid() {
            _autoTunerRefs[interactionOption]->willRebuildNeighborLists();
   };
 
-  if (_stepsSinceLastListRebuild >= _neighborListRebuildFrequency or needRebuild(InteractionTypeOption::pairwise) or
+  if (_stepsSinceLastListRebuild >= _containerSelector.getCurrentContainerInfo().verletRebuildFrequency or
+      needRebuild(InteractionTypeOption::pairwise) or
       needRebuild(InteractionTypeOption::triwise)) {
     _neighborListsAreValid.store(false, std::memory_order_relaxed);
   }
@@ -1038,7 +1348,8 @@ LogicHandler<Particle>::getParticleBuffers() const {
 
 template <typename Particle>
 template <class Functor>
-IterationMeasurements LogicHandler<Particle>::computeInteractions(Functor &functor, TraversalInterface &traversal) {
+IterationMeasurements LogicHandler<Particle>::computeInteractions(Functor &functor, TraversalInterface &traversal,
+                                                                 const Configuration &configuration) {
   // Helper to derive the Functor type at compile time
   constexpr auto interactionType = [] {
     if (utils::isPairwiseFunctor<Functor>()) {
@@ -1055,7 +1366,7 @@ IterationMeasurements LogicHandler<Particle>::computeInteractions(Functor &funct
   }();
   const bool doListRebuild = not _neighborListsAreValid.load(std::memory_order_relaxed);
   auto &autoTuner = *_autoTunerRefs[interactionType];
-  const bool newton3 = autoTuner.getCurrentConfig().newton3;
+  const bool newton3 = configuration.newton3;
   auto &container = _containerSelector.getCurrentContainer();
 
   autopas::utils::Timer timerTotal;
@@ -1064,6 +1375,15 @@ IterationMeasurements LogicHandler<Particle>::computeInteractions(Functor &funct
   autopas::utils::Timer timerComputeRemainder;
 
   const bool energyMeasurementsPossible = autoTuner.resetEnergy();
+  const bool perfCountersPossible = autoTuner.resetPerfCounters();
+
+  // Apply the OpenMP parameters of the configuration. Zero stands for the defaults.
+  traversal.setChunkSize(configuration.chunkSize);
+  traversal.setNumThreads(configuration.threadCount);
+  const auto defaultNumThreads = autopas_get_max_threads();
+  if (configuration.threadCount != 0) {
+    autopas_set_num_threads(static_cast<int>(configuration.threadCount));
+  }
 
   timerTotal.start();
   functor.initTraversal();
@@ -1084,12 +1404,19 @@ IterationMeasurements LogicHandler<Particle>::computeInteractions(Functor &funct
   timerComputeRemainder.stop();
 
   functor.endTraversal(newton3);
-  const auto [energyPsys, energyPkg, energyRam, energyTotal] = autoTuner.sampleEnergy();
+  const auto [energyPsys, energyPkg, energyRam, energyTotal, energyTotalNormalized, meanFrequency, throttleEvents] =
+      autoTuner.sampleEnergy();
   const auto numFLOP = functor.getNumFLOPs();
   const auto energyPerFLOP = energyTotal / numFLOP;
   timerTotal.stop();
+  // read the counters only after the timer is stopped so that the cost of reading them is not part of the total time
+  const auto [instructions, cycles, l1CacheMisses, llcMisses] = autoTuner.samplePerfCounters();
   const auto energyDelayProduct = energyTotal * timerTotal.getTotalTime();
 
+  if (configuration.threadCount != 0) {
+    autopas_set_num_threads(defaultNumThreads);
+  }
+
   constexpr auto nanD = std::numeric_limits<double>::quiet_NaN();
   constexpr auto nanL = std::numeric_limits<long>::quiet_NaN();
   return {timerComputeInteractions.getTotalTime(),
@@ -1103,7 +1430,15 @@ IterationMeasurements LogicHandler<Particle>::computeInteractions(Functor &funct
           energyMeasurementsPossible ? energyTotal : nanL,
           energyMeasurementsPossible ? static_cast<long>(numFLOP) : nanL,
           energyMeasurementsPossible ? static_cast<long>(energyPerFLOP) : nanL,
-          energyMeasurementsPossible ? energyDelayProduct : nanL};
+          energyMeasurementsPossible ? energyDelayProduct : nanL,
+          energyMeasurementsPossible ? meanFrequency : nanD,
+          energyMeasurementsPossible ? throttleEvents : nanL,
+          energyMeasurementsPossible ? energyTotalNormalized : nanL,
+          perfCountersPossible,
+          instructions,
+          cycles,
+          l1CacheMisses,
+          llcMisses};
 }
 
 template <typename Particle>
@@ -1510,9 +1845,10 @@ void LogicHandler<Particle>::remainderHelper3bBufferContainerContainer(const std
 
 template <typename Particle>
 template <class Functor>
-std::tuple<Configuration, std::unique_ptr<TraversalInterface>, bool> LogicHandler<Particle>::selectConfiguration(
+std::tuple<Configuration, std::unique_ptr<TraversalInterface>, bool, bool> LogicHandler<Particle>::selectConfiguration(
     Functor &functor, const InteractionTypeOption &interactionType) {
   bool stillTuning = false;
+  bool sampledOnSubdomain = false;
   Configuration configuration{};
   std::optional<std::unique_ptr<TraversalInterface>> traversalPtrOpt{};
   auto &autoTuner = *_autoTunerRefs[interactionType];
@@ -1520,19 +1856,32 @@ std::tuple<Configuration, std::unique_ptr<TraversalInterface>, bool> LogicHandle
   // https://github.com/AutoPas/AutoPas/issues/916
   LiveInfo info{};
 
-  // if this iteration is not relevant take the same algorithm config as before.
-  if (not functor.isRelevantForTuning()) {
+  // With joint tuning, the triwise interactions follow the container of the pairwise tuner while it tunes.
+  const bool followPairwiseTuner = useJointTuning() and interactionType == InteractionTypeOption::triwise and
+                                   _autoTunerRefs[InteractionTypeOption::pairwise]->inTuningPhase();
+  std::optional<std::tuple<Configuration, std::unique_ptr<TraversalInterface>>> sharedConfiguration{};
+  if (followPairwiseTuner) {
+    _triwiseTuningNeedsRestriction = true;
+    sharedConfiguration = selectSharedTriwiseConfiguration(functor);
+  }
+
+  if (sharedConfiguration.has_value()) {
     stillTuning = false;
-    configuration = autoTuner.getCurrentConfig();
+    configuration = std::get<0>(*sharedConfiguration);
+    traversalPtrOpt = std::move(std::get<1>(*sharedConfiguration));
+  } else if (not functor.isRelevantForTuning()) {
+    // if this iteration is not relevant take the same algorithm config as before.
+    stillTuning = false;
+    // While candidates are only timed on subdomains, the container stays with the last fully computed configuration.
+    const auto subdomainSamplingIter = _subdomainSamplingInPhase.find(interactionType);
+    configuration = autoTuner.inTuningPhase() and subdomainSamplingIter != _subdomainSamplingInPhase.end() and
+                            subdomainSamplingIter->second and _lastComputedConfigurations.count(interactionType) != 0
+                        ? _lastComputedConfigurations[interactionType]
+                        : autoTuner.getCurrentConfig();
     // The currently selected container might not be compatible with the configuration for this functor. Check and
     // change if necessary. (see https://github.com/AutoPas/AutoPas/issues/871)
     if (_containerSelector.getCurrentContainer().getContainerType() != configuration.container) {
-      _containerSelector.selectContainer(
-          configuration.container,
-          ContainerSelectorInfo(
-              configuration.cellSizeFactor,
-              _containerSelector.getCurrentContainer().getVerletSkin() / _neighborListRebuildFrequency,
-              _neighborListRebuildFrequency, _verletClusterSize, configuration.loadEstimator));
+      switchContainer(configuration);
     }
     const auto &container = _containerSelector.getCurrentContainer();
     traversalPtrOpt = autopas::utils::withStaticCellType<Particle>(
@@ -1548,6 +1897,7 @@ std::tuple<Configuration, std::unique_ptr<TraversalInterface>, bool> LogicHandle
                   dynamic_cast<autopas::CellTraversal<std::decay_t<decltype(particleCellDummy)>> *>(
                       traversalPtr.get())) {
             cellTraversalPtr->setSortingThreshold(_sortingThreshold);
+            cellTraversalPtr->setUseSortedSoAWindows(_logicHandlerInfo.useSortedSoAWindows);
           }
           if (traversalPtr->isApplicable()) {
             return std::optional{std::move(traversalPtr)};
@@ -1565,6 +1915,21 @@ std::tuple<Configuration, std::unique_ptr<TraversalInterface>, bool> LogicHandle
       autoTuner.addHomogeneityAndMaxDensity(homogeneity, maxDensity, timerCalculateHomogeneity.getTotalTime());
     }
 
+    // Determine once which configurations can not be used so that tuning phases do not spend iterations on them.
+    if (_checkedApplicabilityInteractionTypes.count(interactionType) == 0 and not autoTuner.searchSpaceIsTrivial()) {
+      _inapplicableConfigurations[interactionType] =
+          findInapplicableConfigurations(autoTuner.getSearchSpace(), functor);
+      autoTuner.setInapplicableConfigurations(_inapplicableConfigurations[interactionType]);
+      _checkedApplicabilityInteractionTypes.insert(interactionType);
+    }
+
+    // With joint tuning, the triwise tuner only starts tuning once the pairwise tuner has chosen the container.
+    if (useJointTuning() and interactionType == InteractionTypeOption::triwise and not followPairwiseTuner and
+        _triwiseTuningNeedsRestriction) {
+      restrictTriwiseTuningToSharedContainer(functor);
+      _triwiseTuningNeedsRestriction = false;
+    }
+
     const auto needsLiveInfo = autoTuner.prepareIteration();
 
     if (needsLiveInfo) {
@@ -1577,6 +1942,35 @@ std::tuple<Configuration, std::unique_ptr<TraversalInterface>, bool> LogicHandle
     // loop as long as we don't get a valid configuration
     bool rejectIndefinitely = false;
     while (true) {
+      if (stillTuning and decideSubdomainSampling(functor, interactionType)) {
+        // Time the candidate on a subdomain and compute the actual step with the previously used configuration or, if
+        // there is none yet or it can not be used, with the candidate. Candidates that can not be timed on the
+        // subdomain are left out of this tuning phase, because a full step would measure something else.
+        auto actualConfiguration = _lastComputedConfigurations.count(interactionType) != 0
+                                       ? _lastComputedConfigurations[interactionType]
+                                       : configuration;
+        auto [actualTraversalPtrOpt, actualRejectIndefinitely] =
+            isConfigurationApplicable(actualConfiguration, functor, interactionType);
+        if (not actualTraversalPtrOpt.has_value() and actualConfiguration != configuration) {
+          actualConfiguration = configuration;
+          std::tie(actualTraversalPtrOpt, actualRejectIndefinitely) =
+              isConfigurationApplicable(configuration, functor, interactionType);
+        }
+        bool sampled = false;
+        rejectIndefinitely = actualRejectIndefinitely;
+        if (actualTraversalPtrOpt.has_value()) {
+          std::tie(sampled, rejectIndefinitely) =
+              sampleConfigurationOnSubdomain(configuration, functor, interactionType);
+        }
+        if (sampled) {
+          configuration = actualConfiguration;
+          traversalPtrOpt = std::move(actualTraversalPtrOpt);
+          sampledOnSubdomain = true;
+          break;
+        }
+        std::tie(configuration, stillTuning) = autoTuner.rejectConfig(configuration, rejectIndefinitely);
+        continue;
+      }
       // applicability check also sets the container
       std::tie(traversalPtrOpt, rejectIndefinitely) =
           isConfigurationApplicable(configuration, functor, interactionType);
@@ -1596,7 +1990,7 @@ std::tuple<Configuration, std::unique_ptr<TraversalInterface>, bool> LogicHandle
   _liveInfoLogger.logLiveInfo(info, _iteration);
 #endif
 
-  return {configuration, std::move(traversalPtrOpt.value()), stillTuning};
+  return {configuration, std::move(traversalPtrOpt.value()), stillTuning, sampledOnSubdomain};
 }
 
 template <typename Particle>
@@ -1609,12 +2003,23 @@ bool LogicHandler<Particle>::computeInteractionsPipeline(Functor *functor,
         "{}.",
         interactionType);
   }
+  // A pending sample of the pairwise tuner means that updateContainer() was not called since the last pairwise step.
+  if (useJointTuning() and interactionType == InteractionTypeOption::pairwise and _jointStepSample.has_value()) {
+    passJointStepMeasurement();
+  }
+
   /// Selection of configuration (tuning if necessary)
+  const auto containerBeforeSelection = _containerSelector.getCurrentContainer().getContainerType();
+  _pendingContainerSwitch.reset();
   utils::Timer tuningTimer;
   tuningTimer.start();
-  const auto [configuration, traversalPtr, stillTuning] = selectConfiguration(*functor, interactionType);
+  const auto [configuration, traversalPtr, stillTuning, sampledOnSubdomain] =
+      selectConfiguration(*functor, interactionType);
   tuningTimer.stop();
   auto &autoTuner = *_autoTunerRefs[interactionType];
+  if (not autoTuner.inTuningPhase()) {
+    _subdomainSamplingInPhase.erase(interactionType);
+  }
   autoTuner.logTuningResult(stillTuning, tuningTimer.getTotalTime());
 
   // Retrieve rebuild info before calling `computeInteractions()` to get the correct value.
@@ -1622,7 +2027,34 @@ bool LogicHandler<Particle>::computeInteractionsPipeline(Functor *functor,
 
   /// Computing the particle interactions
   AutoPasLog(DEBUG, "Iterating with configuration: {} tuning: {}", configuration.toString(), stillTuning);
-  const IterationMeasurements measurements = computeInteractions(*functor, *traversalPtr);
+  const auto [measurements, sampledSpeculatively] = [&]() -> std::tuple<IterationMeasurements, bool> {
+    // The functor is copied for the second team, so this is only possible for copyable functors.
+    if constexpr (std::is_copy_constructible_v<Functor>) {
+      if (stillTuning and not sampledOnSubdomain and rebuildIteration and functor->isRelevantForTuning() and
+          useThreadTeamSampling(interactionType)) {
+        if (const auto speculativeConfiguration = autoTuner.getSpeculativeConfig()) {
+          return computeInteractionsWithSpeculativeSample(*functor, *traversalPtr, configuration,
+                                                          *speculativeConfiguration, interactionType);
+        }
+      }
+    }
+    return {computeInteractions(*functor, *traversalPtr, configuration), false};
+  }();
+  _lastComputedConfigurations[interactionType] = configuration;
+
+  // Only the switch to the container of the used configuration is charged, and only to the tuner that selected it.
+  if (_pendingContainerSwitch.has_value() and configuration.container != containerBeforeSelection and
+      std::get<0>(*_pendingContainerSwitch) == configuration.container) {
+    auto timeSwitch = std::get<1>(*_pendingContainerSwitch);
+    if (rebuildIteration) {
+      timeSwitch += measurements.timeRebuild;
+    }
+    autoTuner.addContainerSwitchCost(containerBeforeSelection, configuration.container, timeSwitch);
+  }
+  _pendingContainerSwitch.reset();
+  for (auto &[type, tuner] : _autoTunerRefs) {
+    tuner->setActiveContainer(configuration.container);
+  }
 
   /// Debug Output
   auto bufferSizeListing = [](const auto &buffers) -> std::string {
@@ -1646,6 +2078,10 @@ bool LogicHandler<Particle>::computeInteractionsPipeline(Functor *functor,
     AutoPasLog(DEBUG, "Energy Consumption: Psys: {} Joules Pkg: {} Joules Ram: {} Joules", measurements.energyPsys,
                measurements.energyPkg, measurements.energyRam);
   }
+  if (measurements.perfCountersPossible) {
+    AutoPasLog(DEBUG, "Hardware Counters: Instructions: {} Cycles: {} L1 Misses: {} LLC Misses: {}",
+               measurements.instructions, measurements.cycles, measurements.l1CacheMisses, measurements.llcMisses);
+  }
   _iterationLogger.logIteration(configuration, _iteration, functor->getName(), stillTuning, tuningTimer.getTotalTime(),
                                 measurements, functor->getNumFLOPs());
 
@@ -1654,25 +2090,36 @@ bool LogicHandler<Particle>::computeInteractionsPipeline(Functor *functor,
   /// Pass on measurements
   // if this was a major iteration add measurements
   if (functor->isRelevantForTuning()) {
-    if (stillTuning) {
-      // choose the metric of interest
-      const auto measurement = [&]() {
-        switch (autoTuner.getTuningMetric()) {
-          case TuningMetricOption::time:
-            return measurements.timeTotal;
-          case TuningMetricOption::energy:
-            return measurements.energyTotal;
-          case TuningMetricOption::energyPerFLOP:
-            return static_cast<long>(measurements.energyTotal / functor->getNumFLOPs());
-          case TuningMetricOption::energyDelayProduct:
-            return measurements.energyTotal * measurements.timeTotal;
-          default:
-            autopas::utils::ExceptionHandler::exception(
-                "LogicHandler::computeInteractionsPipeline(): Unknown tuning metric.");
-            return 0l;
-        }
-      }();
-      autoTuner.addMeasurement(measurement, rebuildIteration);
+    // Samples taken on a subdomain were already passed on in selectConfiguration(). A step that ran next to a
+    // speculative sample only used a part of the threads and was passed on as its reference.
+    const bool passOnMeasurement = (stillTuning or autoTuner.tunesContinuously() or autoTuner.retunesOnDrift()) and
+                                   not sampledOnSubdomain and not sampledSpeculatively;
+    // With joint tuning, the pairwise tuner gets the cost of the whole step in updateContainer().
+    const bool jointStepSample = useJointTuning() and interactionType == InteractionTypeOption::pairwise;
+    if (useJointTuning()) {
+      _jointStepMeasurements.timeTotal += measurements.timeTotal;
+      _jointStepMeasurements.energyTotal += measurements.energyTotal;
+      _jointStepMeasurements.energyTotalNormalized += measurements.energyTotalNormalized;
+      _jointStepMeasurements.cycles += measurements.cycles;
+      _jointStepMeasurements.llcMisses += measurements.llcMisses;
+      _jointStepNumFLOPs += functor->getNumFLOPs();
+      if (jointStepSample and passOnMeasurement) {
+        _jointStepSample = {rebuildIteration, stillTuning};
+      }
+    }
+    if (passOnMeasurement and not jointStepSample) {
+      const auto measurement = tuningSample(autoTuner.getTuningMetric(), measurements, functor->getNumFLOPs());
+      if (stillTuning) {
+        autoTuner.addMeasurement(measurement, rebuildIteration, measurements.timeTotal);
+      } else {
+        autoTuner.addNonTuningMeasurement(measurement, rebuildIteration);
+      }
+    }
+    // The particle distribution only needs to be checked for drift when the neighbor lists were rebuilt.
+    const auto &container = _containerSelector.getCurrentContainer();
+    if (autoTuner.retunesOnDrift() and rebuildIteration and not stillTuning and container.getNumberOfParticles() > 0) {
+      const auto [homogeneity, maxDensity] = autopas::utils::calculateHomogeneityAndMaxDensity(container);
+      autoTuner.addScenarioStatistics(homogeneity, maxDensity);
     }
   } else {
     AutoPasLog(TRACE, "Skipping adding of sample because functor is not marked relevant.");
@@ -1683,30 +2130,245 @@ bool LogicHandler<Particle>::computeInteractionsPipeline(Functor *functor,
 
 template <typename Particle>
 template <class Functor>
-std::tuple<std::optional<std::unique_ptr<TraversalInterface>>, bool> LogicHandler<Particle>::isConfigurationApplicable(
+bool LogicHandler<Particle>::decideSubdomainSampling(Functor &functor, const InteractionTypeOption &interactionType) {
+  const auto decisionIter = _subdomainSamplingInPhase.find(interactionType);
+  if (decisionIter != _subdomainSamplingInPhase.end()) {
+    return decisionIter->second;
+  }
+
+  bool useSubdomain = false;
+  // Samples are taken with a copy of the functor.
+  if constexpr (std::is_copy_constructible_v<Functor>) {
+    useSubdomain = useSubdomainSampling(interactionType);
+    if (useSubdomain) {
+      const auto [subdomainMin, subdomainMax] = getTuningSubdomain();
+      const auto &inapplicableConfigurations = _inapplicableConfigurations[interactionType];
+      // Candidates with the same container and container parameters share one copy of the subdomain.
+      std::vector<std::tuple<ContainerOption, ContainerSelectorInfo,
+                             std::unique_ptr<ParticleContainerInterface<Particle>>>>
+          subdomainContainers{};
+      for (const auto &conf : _autoTunerRefs[interactionType]->getConfigQueue()) {
+        // These will be rejected anyway.
+        if (inapplicableConfigurations.count(conf) != 0) {
+          continue;
+        }
+        const auto containerInfo = makeContainerSelectorInfo(conf);
+        auto subdomainContainerIter =
+            std::find_if(subdomainContainers.begin(), subdomainContainers.end(), [&](const auto &entry) {
+              return std::get<0>(entry) == conf.container and std::get<1>(entry) == containerInfo;
+            });
+        if (subdomainContainerIter == subdomainContainers.end()) {
+          subdomainContainers.emplace_back(conf.container, containerInfo,
+                                           _containerSelector.generateSubdomainContainer(
+                                               conf.container, containerInfo, subdomainMin, subdomainMax));
+          subdomainContainerIter = std::prev(subdomainContainers.end());
+        }
+        auto &subdomainContainer = *std::get<2>(*subdomainContainerIter);
+        if (subdomainContainer.getNumberOfParticles(IteratorBehavior::owned) == 0 or
+            not generateTraversalForContainer(conf, functor, subdomainContainer).has_value()) {
+          AutoPasLog(DEBUG, "{} can not be timed on the tuning subdomain. Timing all candidates with full steps.",
+                     conf.toShortString());
+          useSubdomain = false;
+          break;
+        }
+      }
+    }
+  }
+  _subdomainSamplingInPhase[interactionType] = useSubdomain;
+  return useSubdomain;
+}
+
+template <typename Particle>
+template <class Functor>
+std::optional<std::unique_ptr<TraversalInterface>> LogicHandler<Particle>::generateTraversalForContainer(
+    const Configuration &conf, Functor &functor, ParticleContainerInterface<Particle> &container) const {
+  return autopas::utils::withStaticCellType<Particle>(
+      container.getParticleCellTypeEnum(),
+      [&](const auto &particleCellDummy) -> std::optional<std::unique_ptr<TraversalInterface>> {
+        auto traversalPtr =
+            TraversalSelector<std::decay_t<decltype(particleCellDummy)>>::template generateTraversal<Functor>(
+                conf.traversal, functor, container.getTraversalSelectorInfo(), conf.dataLayout, conf.newton3);
+        if (auto *cellTraversalPtr =
+                dynamic_cast<autopas::CellTraversal<std::decay_t<decltype(particleCellDummy)>> *>(traversalPtr.get())) {
+          cellTraversalPtr->setSortingThreshold(_sortingThreshold);
+          cellTraversalPtr->setUseSortedSoAWindows(_logicHandlerInfo.useSortedSoAWindows);
+        }
+        if (traversalPtr->isApplicable()) {
+          return std::optional{std::move(traversalPtr)};
+        } else {
+          return std::nullopt;
+        }
+      });
+}
+
+template <typename Particle>
+template <class Functor>
+std::tuple<bool, bool> LogicHandler<Particle>::sampleConfigurationOnSubdomain(
     const Configuration &conf, Functor &functor, const InteractionTypeOption &interactionType) {
+  if (not isConfigurationCompatible(conf, functor)) {
+    return {false, true};
+  }
+
+  if constexpr (not std::is_copy_constructible_v<Functor>) {
+    return {false, false};
+  } else {
+    const auto [subdomainMin, subdomainMax] = getTuningSubdomain();
+    auto subdomainContainer = _containerSelector.generateSubdomainContainer(
+        conf.container, makeContainerSelectorInfo(conf), subdomainMin, subdomainMax);
+    const auto numParticlesOwnedSubdomain = subdomainContainer->getNumberOfParticles(IteratorBehavior::owned);
+    if (numParticlesOwnedSubdomain == 0) {
+      AutoPasLog(DEBUG, "No owned particles in the tuning subdomain. Leaving {} out of this tuning phase.",
+                 conf.toShortString());
+      return {false, false};
+    }
+
+    Functor sampleFunctor{functor};
+    auto traversalPtrOpt = generateTraversalForContainer(conf, sampleFunctor, *subdomainContainer);
+    if (not traversalPtrOpt.has_value()) {
+      AutoPasLog(DEBUG, "{} is not applicable on the tuning subdomain. Leaving it out of this tuning phase.",
+                 conf.toShortString());
+      return {false, false};
+    }
+    traversalPtrOpt.value()->setChunkSize(conf.chunkSize);
+    traversalPtrOpt.value()->setNumThreads(conf.threadCount);
+
+    // The actual step only pays for the rebuild if it rebuilds its own neighbor lists.
+    const auto rebuildIteration = not _neighborListsAreValid.load(std::memory_order_relaxed);
+    utils::Timer timerSubdomain;
+    utils::Timer timerRebuild;
+    // Run with the threads of the configuration, like computeInteractions() does for full steps.
+    const auto defaultNumThreads = autopas_get_max_threads();
+    if (conf.threadCount != 0) {
+      autopas_set_num_threads(static_cast<int>(conf.threadCount));
+    }
+    timerSubdomain.start();
+    sampleFunctor.initTraversal();
+    timerRebuild.start();
+    subdomainContainer->rebuildNeighborLists(traversalPtrOpt.value().get());
+    timerRebuild.stop();
+    subdomainContainer->computeInteractions(traversalPtrOpt.value().get());
+    sampleFunctor.endTraversal(conf.newton3);
+    timerSubdomain.stop();
+    if (conf.threadCount != 0) {
+      autopas_set_num_threads(defaultNumThreads);
+    }
+
+    const auto timeSubdomain = timerSubdomain.getTotalTime() - (rebuildIteration ? 0l : timerRebuild.getTotalTime());
+    const auto extrapolationFactor =
+        static_cast<double>(_numParticlesOwned.load(std::memory_order_relaxed)) / numParticlesOwnedSubdomain;
+    const auto sample = static_cast<long>(static_cast<double>(timeSubdomain) * extrapolationFactor);
+    AutoPasLog(DEBUG, "Sampled {} on a subdomain with {} owned particles: {} ns, extrapolated to {} ns.",
+               conf.toShortString(), numParticlesOwnedSubdomain, timeSubdomain, sample);
+
+    _autoTunerRefs[interactionType]->addMeasurement(sample, rebuildIteration);
+    return {true, false};
+  }
+}
+
+template <typename Particle>
+template <class Functor>
+std::tuple<IterationMeasurements, bool> LogicHandler<Particle>::computeInteractionsWithSpeculativeSample(
+    Functor &functor, TraversalInterface &traversal, const Configuration &configuration,
+    const Configuration &speculativeConfiguration, const InteractionTypeOption &interactionType) {
+  if (not isConfigurationCompatible(speculativeConfiguration, functor)) {
+    return {computeInteractions(functor, traversal, configuration), false};
+  }
+
+  // Prepare the copy and its traversal before the teams start so that only the interactions are timed.
+  const auto &container = _containerSelector.getCurrentContainer();
+  auto speculativeContainer = _containerSelector.generateSubdomainContainer(
+      speculativeConfiguration.container, makeContainerSelectorInfo(speculativeConfiguration), container.getBoxMin(),
+      container.getBoxMax());
+  Functor speculativeFunctor{functor};
+  auto speculativeTraversalPtrOpt =
+      generateTraversalForContainer(speculativeConfiguration, speculativeFunctor, *speculativeContainer);
+  if (not speculativeTraversalPtrOpt.has_value()) {
+    AutoPasLog(DEBUG, "{} is not applicable on the copy of the container. Not sampling it ahead.",
+               speculativeConfiguration.toShortString());
+    return {computeInteractions(functor, traversal, configuration), false};
+  }
+  auto &speculativeTraversal = *speculativeTraversalPtrOpt.value();
+
+  // Split the threads and cap the thread counts of both configurations at the size of their team.
+  const auto numThreads = autopas_get_max_threads();
+  const auto numThreadsFirstTeam = numThreads - numThreads / 2;
+  const auto teamThreadCount = [](const Configuration &conf, int teamSize) {
+    return conf.threadCount != 0 ? std::min(static_cast<int>(conf.threadCount), teamSize) : teamSize;
+  };
+  auto firstTeamConfiguration = configuration;
+  firstTeamConfiguration.threadCount = teamThreadCount(configuration, numThreadsFirstTeam);
+  const auto numThreadsSecondTeam = teamThreadCount(speculativeConfiguration, numThreads - numThreadsFirstTeam);
+  speculativeTraversal.setChunkSize(speculativeConfiguration.chunkSize);
+  speculativeTraversal.setNumThreads(numThreadsSecondTeam);
+
+  // The second team is led by its own thread and not by a nested parallel region, because container iterators split
+  // their range among the threads of the enclosing parallel region.
+  utils::Timer timerSpeculative;
+  std::exception_ptr secondTeamException{nullptr};
+  std::thread secondTeam([&]() {
+    try {
+      autopas_set_num_threads(numThreadsSecondTeam);
+      timerSpeculative.start();
+      speculativeFunctor.initTraversal();
+      speculativeContainer->rebuildNeighborLists(&speculativeTraversal);
+      speculativeContainer->computeInteractions(&speculativeTraversal);
+      speculativeFunctor.endTraversal(speculativeConfiguration.newton3);
+      timerSpeculative.stop();
+    } catch (...) {
+      secondTeamException = std::current_exception();
+    }
+  });
+  IterationMeasurements measurements{};
+  try {
+    measurements = computeInteractions(functor, traversal, firstTeamConfiguration);
+  } catch (...) {
+    secondTeam.join();
+    throw;
+  }
+  secondTeam.join();
+  if (secondTeamException) {
+    std::rethrow_exception(secondTeamException);
+  }
+
+  const auto sample = timerSpeculative.getTotalTime();
+  const auto referenceSample = measurements.timeTotal - measurements.timeRemainderTraversal;
+  AutoPasLog(DEBUG, "Sampled {} with a second thread team: {} ns. {} took {} ns next to it.",
+             speculativeConfiguration.toShortString(), sample, configuration.toShortString(), referenceSample);
+  _autoTunerRefs[interactionType]->addSpeculativeMeasurement(speculativeConfiguration, sample, referenceSample);
+  return {measurements, true};
+}
+
+template <typename Particle>
+template <class Functor>
+bool LogicHandler<Particle>::isConfigurationCompatible(const Configuration &conf, Functor &functor) const {
   // Check if the container supports the traversal
   const auto allContainerTraversals =
       compatibleTraversals::allCompatibleTraversals(conf.container, conf.interactionType);
   if (allContainerTraversals.find(conf.traversal) == allContainerTraversals.end()) {
     AutoPasLog(WARN, "Configuration rejected: Container {} does not support the traversal {}.", conf.container,
                conf.traversal);
-    return {std::nullopt, true};
+    return false;
   }
 
   // Check if the required Newton 3 mode is supported by the functor
   if ((conf.newton3 == Newton3Option::enabled and not functor.allowsNewton3()) or
       (conf.newton3 == Newton3Option::disabled and not functor.allowsNonNewton3())) {
     AutoPasLog(DEBUG, "Configuration rejected: The functor doesn't support Newton 3 {}!", conf.newton3);
+    return false;
+  }
+  return true;
+}
+
+template <typename Particle>
+template <class Functor>
+std::tuple<std::optional<std::unique_ptr<TraversalInterface>>, bool> LogicHandler<Particle>::isConfigurationApplicable(
+    const Configuration &conf, Functor &functor, const InteractionTypeOption &interactionType) {
+  if (not isConfigurationCompatible(conf, functor)) {
     return {std::nullopt, true};
   }
 
   // Check if the traversal is applicable to the current state of the container
-  _containerSelector.selectContainer(
-      conf.container,
-      ContainerSelectorInfo(conf.cellSizeFactor,
-                            _containerSelector.getCurrentContainer().getVerletSkin() / _neighborListRebuildFrequency,
-                            _neighborListRebuildFrequency, _verletClusterSize, conf.loadEstimator));
+  switchContainer(conf);
   const auto &container = _containerSelector.getCurrentContainer();
   const auto traversalInfo = container.getTraversalSelectorInfo();
 
@@ -1722,6 +2384,7 @@ std::tuple<std::optional<std::unique_ptr<TraversalInterface>>, bool> LogicHandle
         if (auto *cellTraversalPtr =
                 dynamic_cast<autopas::CellTraversal<std::decay_t<decltype(particleCellDummy)>> *>(traversalPtr.get())) {
           cellTraversalPtr->setSortingThreshold(_sortingThreshold);
+          cellTraversalPtr->setUseSortedSoAWindows(_logicHandlerInfo.useSortedSoAWindows);
         }
         if (traversalPtr->isApplicable()) {
           return std::optional{std::move(traversalPtr)};
@@ -1732,4 +2395,167 @@ std::tuple<std::optional<std::unique_ptr<TraversalInterface>>, bool> LogicHandle
   return {std::move(traversalPtrOpt), false};
 }
 
+template <typename Particle>
+template <class Functor>
+std::set<Configuration> LogicHandler<Particle>::findInapplicableConfigurations(
+    const std::set<Configuration> &configurations, Functor &functor) {
+  std::set<Configuration> inapplicableConfigurations;
+
+  // Group the configurations by the container they need so that every empty container is only created once.
+  std::vector<std::tuple<ContainerOption, ContainerSelectorInfo, std::vector<Configuration>>> configurationsPerContainer;
+  for (const auto &conf : configurations) {
+    if (not isConfigurationCompatible(conf, functor)) {
+      inapplicableConfigurations.insert(conf);
+      continue;
+    }
+    // The towers of verlet cluster lists and the leaves of octrees depend on the particles, so their traversals can
+    // only be checked on the actual container.
+    if (conf.container == ContainerOption::verletClusterLists or conf.container == ContainerOption::octree) {
+      continue;
+    }
+    const auto containerInfo = makeContainerSelectorInfo(conf);
+    auto groupIter = std::find_if(configurationsPerContainer.begin(), configurationsPerContainer.end(),
+                                  [&](const auto &group) {
+                                    return std::get<0>(group) == conf.container and std::get<1>(group) == containerInfo;
+                                  });
+    if (groupIter == configurationsPerContainer.end()) {
+      configurationsPerContainer.emplace_back(conf.container, containerInfo, std::vector<Configuration>{});
+      groupIter = std::prev(configurationsPerContainer.end());
+    }
+    std::get<2>(*groupIter).push_back(conf);
+  }
+
+  for (const auto &[containerOption, containerInfo, groupConfigurations] : configurationsPerContainer) {
+    const auto container = _containerSelector.generateEmptyContainer(containerOption, containerInfo);
+    const auto traversalInfo = container->getTraversalSelectorInfo();
+    for (const auto &conf : groupConfigurations) {
+      const auto applicable = autopas::utils::withStaticCellType<Particle>(
+          container->getParticleCellTypeEnum(), [&](const auto &particleCellDummy) {
+            const auto traversalPtr =
+                TraversalSelector<std::decay_t<decltype(particleCellDummy)>>::template generateTraversal<Functor>(
+                    conf.traversal, functor, traversalInfo, conf.dataLayout, conf.newton3);
+            return traversalPtr->isApplicable();
+          });
+      if (not applicable) {
+        inapplicableConfigurations.insert(conf);
+      }
+    }
+  }
+  return inapplicableConfigurations;
+}
+
+template <typename Particle>
+long LogicHandler<Particle>::tuningSample(const TuningMetricOption &tuningMetric,
+                                          const IterationMeasurements &measurements, size_t numFLOPs) {
+  switch (tuningMetric) {
+    case TuningMetricOption::time:
+      return measurements.timeTotal;
+    case TuningMetricOption::energy:
+      return measurements.energyTotal;
+    case TuningMetricOption::energyPerFLOP:
+      return static_cast<long>(measurements.energyTotal / numFLOPs);
+    case TuningMetricOption::energyDelayProduct:
+      return measurements.energyTotal * measurements.timeTotal;
+    case TuningMetricOption::cycles:
+      return measurements.cycles;
+    case TuningMetricOption::llcMisses:
+      return measurements.llcMisses;
+    case TuningMetricOption::energyBoundedSlowdown:
+      return measurements.energyTotalNormalized;
+    default:
+      autopas::utils::ExceptionHandler::exception("LogicHandler::tuningSample(): Unknown tuning metric.");
+      return 0l;
+  }
+}
+
+template <typename Particle>
+void LogicHandler<Particle>::passJointStepMeasurement() {
+  if (_jointStepSample.has_value()) {
+    const auto [rebuildIteration, stillTuning] = *_jointStepSample;
+    auto &autoTuner = *_autoTunerRefs[InteractionTypeOption::pairwise];
+    const auto sample = tuningSample(autoTuner.getTuningMetric(), _jointStepMeasurements, _jointStepNumFLOPs);
+    AutoPasLog(TRACE, "Combined cost of the step: {}", sample);
+    if (stillTuning) {
+      autoTuner.addMeasurement(sample, rebuildIteration, _jointStepMeasurements.timeTotal);
+    } else {
+      autoTuner.addNonTuningMeasurement(sample, rebuildIteration);
+    }
+  }
+  _jointStepSample.reset();
+  _jointStepMeasurements = {};
+  _jointStepNumFLOPs = 0;
+}
+
+template <typename Particle>
+template <class Functor>
+std::optional<std::tuple<Configuration, std::unique_ptr<TraversalInterface>>>
+LogicHandler<Particle>::selectSharedTriwiseConfiguration(Functor &functor) {
+  const auto &triwiseTuner = *_autoTunerRefs[InteractionTypeOption::triwise];
+  const auto &pairwiseConfiguration = _lastComputedConfigurations.count(InteractionTypeOption::pairwise) != 0
+                                          ? _lastComputedConfigurations[InteractionTypeOption::pairwise]
+                                          : _autoTunerRefs[InteractionTypeOption::pairwise]->getCurrentConfig();
+
+  // Rank the candidates: the current configuration first, then by the latest evidence, unknown ones last.
+  std::vector<std::tuple<bool, long, Configuration>> candidates;
+  for (const auto &conf : triwiseTuner.getSearchSpace()) {
+    if (sharesContainer(conf, pairwiseConfiguration)) {
+      const auto *evidence = triwiseTuner.getEvidenceCollection().getEvidence(conf);
+      const auto value =
+          evidence == nullptr or evidence->empty() ? std::numeric_limits<long>::max() : evidence->back().value;
+      candidates.emplace_back(not(conf == triwiseTuner.getCurrentConfig()), value, conf);
+    }
+  }
+  std::sort(candidates.begin(), candidates.end());
+
+  for (const auto &[notCurrent, value, conf] : candidates) {
+    auto [traversalPtrOpt, rejectIndefinitely] =
+        isConfigurationApplicable(conf, functor, InteractionTypeOption::triwise);
+    if (traversalPtrOpt.has_value()) {
+      return std::make_tuple(conf, std::move(*traversalPtrOpt));
+    }
+  }
+  AutoPasLog(DEBUG, "No triwise configuration shares the container of {}.", pairwiseConfiguration.toShortString());
+  return std::nullopt;
+}
+
+template <typename Particle>
+template <class Functor>
+void LogicHandler<Particle>::restrictTriwiseTuningToSharedContainer(Functor &functor) {
+  auto &triwiseTuner = *_autoTunerRefs[InteractionTypeOption::triwise];
+  if (triwiseTuner.searchSpaceIsTrivial()) {
+    return;
+  }
+  const auto &pairwiseConfiguration = _autoTunerRefs[InteractionTypeOption::pairwise]->getCurrentConfig();
+  const auto &inapplicableConfigurations = _inapplicableConfigurations[InteractionTypeOption::triwise];
+
+  auto excludedConfigurations = inapplicableConfigurations;
+  for (const auto &conf : triwiseTuner.getSearchSpace()) {
+    if (not sharesContainer(conf, pairwiseConfiguration)) {
+      excludedConfigurations.insert(conf);
+    }
+  }
+  if (excludedConfigurations.size() == triwiseTuner.getSearchSpace().size()) {
+    AutoPasLog(WARN, "No applicable triwise configuration shares the container of {}. Tuning all of them.",
+               pairwiseConfiguration.toShortString());
+    excludedConfigurations = inapplicableConfigurations;
+  }
+  triwiseTuner.setInapplicableConfigurations(std::move(excludedConfigurations));
+  // A tuning phase that already started keeps its queue, otherwise a new one starts for the shared container.
+  if (not triwiseTuner.inTuningPhase()) {
+    triwiseTuner.forceRetune();
+  }
+}
+
+template <typename Particle>
+void LogicHandler<Particle>::switchContainer(const Configuration &conf) {
+  const auto previousContainer = _containerSelector.getCurrentContainer().getContainerType();
+  utils::Timer timerSwitch;
+  timerSwitch.start();
+  _containerSelector.selectContainer(conf.container, makeContainerSelectorInfo(conf));
+  timerSwitch.stop();
+  if (previousContainer != conf.container) {
+    _pendingContainerSwitch = {conf.container, timerSwitch.getTotalTime()};
+  }
+}
+
 }  // namespace autopas
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "array"
+#include "limits"
 #include "string"
 
 namespace autopas {
@@ -39,5 +40,36 @@ class LogicHandlerInfo {
    * Number of particles in two cells from which sorting should be performed for traversal that use the CellFunctor
    */
   size_t sortingThreshold{8};
+  /**
+   * Sort the particles of each cell before loading SoAs so that traversals using the CellFunctor can restrict
+   * SoAFunctorPair calls to windows of particles within the cutoff.
+   */
+  bool useSortedSoAWindows{false};
+  /**
+   * Fraction of the domain volume on which configurations are timed during tuning. The measurement is extrapolated to
+   * the whole domain while the actual step is computed with the previously used configuration. 1 means that every
+   * configuration is measured with full steps.
+   */
+  double tuningSubdomainFraction{1.};
+  /**
+   * Split the threads into two teams during tuning. The second team samples a later candidate configuration on a copy
+   * of the container while the first team computes the actual step. The samples are only used to skip candidates.
+   * This adds one iteration per sampled candidate and copies the full container in each of them.
+   */
+  bool tuningThreadTeams{false};
+  /**
+   * Tune pairwise and triwise interactions jointly for the cost of the whole step, so both use the same container.
+   * Only has an effect if both interaction types are used. See LogicHandler::useJointTuning().
+   */
+  bool jointInteractionTuning{false};
+  /**
+   * Number of previously used containers that are kept alive during tuning to speed up switching back to them.
+   * Zero disables shadow containers.
+   */
+  size_t numShadowContainers{0};
+  /**
+   * Maximal estimated memory in bytes that all shadow containers may occupy together.
+   */
+  size_t shadowContainerMemoryBudget{std::numeric_limits<size_t>::max()};
 };
 }  // namespace autopas
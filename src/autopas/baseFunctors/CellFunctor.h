@@ -7,9 +7,12 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include "autopas/cells/SortedCellView.h"
 #include "autopas/options/DataLayoutOption.h"
 #include "autopas/utils/ExceptionHandler.h"
+#include "autopas/utils/SoAView.h"
 
 namespace autopas::internal {
 /**
@@ -78,6 +81,17 @@ class CellFunctor {
    */
   void setSortingThreshold(size_t sortingThreshold);
 
+  /**
+   * Enable or disable sorted SoA windows.
+   * If enabled, the caller guarantees that the SoA buffers of all cells are sorted along
+   * sortedSoAWindowDimension(cell.getCellLength()). For cell pairs above the sorting-threshold, SoAFunctorPair is then
+   * only called on index windows of particles whose projected distance along this dimension is within the sorting
+   * cutoff.
+   * @note This only has an effect if the functor loads all positions into the SoA.
+   * @param useSortedSoAWindows
+   */
+  void setUseSortedSoAWindows(bool useSortedSoAWindows);
+
  private:
   /**
    * Applies the functor to all particle pairs exploiting newtons third law of motion.
@@ -113,6 +127,16 @@ class CellFunctor {
 
   void processCellPairSoANoN3(ParticleCell &cell1, ParticleCell &cell2);
 
+  /**
+   * Applies the functor to all particle pairs between cell1 and cell2 whose SoA buffers are sorted along the sorted SoA
+   * window dimension. Cell1 is processed in blocks and for every block only the window of cell2 that lies within the
+   * sorting cutoff along this dimension is passed to SoAFunctorPair.
+   * @param cell1
+   * @param cell2
+   * @param newton3
+   */
+  void processCellPairSoASortedWindows(ParticleCell &cell1, ParticleCell &cell2, bool newton3);
+
   void processCellSoAN3(ParticleCell &cell);
 
   void processCellSoANoN3(ParticleCell &cell);
@@ -127,6 +151,17 @@ class CellFunctor {
    */
   size_t _sortingThreshold{8};
 
+  /**
+   * Number of particles of the first cell that are processed in one SoAFunctorPair call when sorted SoA windows are
+   * used. Small blocks prune more pairs, large blocks give the vectorized inner loop more work per call.
+   */
+  constexpr static size_t _sortedSoAWindowBlockSize{8};
+
+  /**
+   * If true, the SoA buffers are sorted along sortedSoAWindowDimension() and cell pairs are processed in windows.
+   */
+  bool _useSortedSoAWindows{false};
+
   DataLayoutOption _dataLayout;
 
   bool _useNewton3;
@@ -137,6 +172,11 @@ void CellFunctor<ParticleCell, ParticleFunctor, bidirectional>::setSortingThresh
   _sortingThreshold = sortingThreshold;
 }
 
+template <class ParticleCell, class ParticleFunctor, bool bidirectional>
+void CellFunctor<ParticleCell, ParticleFunctor, bidirectional>::setUseSortedSoAWindows(bool useSortedSoAWindows) {
+  _useSortedSoAWindows = useSortedSoAWindows;
+}
+
 template <class ParticleCell, class ParticleFunctor, bool bidirectional>
 void CellFunctor<ParticleCell, ParticleFunctor, bidirectional>::processCell(ParticleCell &cell) {
   if ((_dataLayout == DataLayoutOption::soa and cell._particleSoABuffer.size() == 0) or
@@ -194,6 +234,14 @@ void CellFunctor<ParticleCell, ParticleFunctor, bidirectional>::processCellPair(
       }
       break;
     case DataLayoutOption::soa:
+      if constexpr (functorSupportsSortedSoAWindows<ParticleFunctor, typename ParticleCell::ParticleType>()) {
+        if (_useSortedSoAWindows and
+            (cell1._particleSoABuffer.size() + cell2._particleSoABuffer.size() > _sortingThreshold) and
+            (sortingDirection != std::array<double, 3>{0., 0., 0.})) {
+          processCellPairSoASortedWindows(cell1, cell2, _useNewton3);
+          break;
+        }
+      }
       if (_useNewton3) {
         processCellPairSoAN3(cell1, cell2);
       } else {
@@ -315,6 +363,53 @@ void CellFunctor<ParticleCell, ParticleFunctor, bidirectional>::processCellPairS
   }
 }
 
+template <class ParticleCell, class ParticleFunctor, bool bidirectional>
+void CellFunctor<ParticleCell, ParticleFunctor, bidirectional>::processCellPairSoASortedWindows(ParticleCell &cell1,
+                                                                                                ParticleCell &cell2,
+                                                                                                bool newton3) {
+  using AttributeNames = typename ParticleCell::ParticleType::AttributeNames;
+  auto &soa1 = cell1._particleSoABuffer;
+  auto &soa2 = cell2._particleSoABuffer;
+
+  const auto sortingDim = sortedSoAWindowDimension(cell1.getCellLength());
+  const auto positionsAlongSortingDim = [&](auto &soa) {
+    switch (sortingDim) {
+      case 0:
+        return soa.template begin<AttributeNames::posX>();
+      case 1:
+        return soa.template begin<AttributeNames::posY>();
+      default:
+        return soa.template begin<AttributeNames::posZ>();
+    }
+  };
+  const double *const pos1Begin = positionsAlongSortingDim(soa1);
+  const double *const pos1End = pos1Begin + soa1.size();
+  const double *const pos2Begin = positionsAlongSortingDim(soa2);
+  const double *const pos2End = pos2Begin + soa2.size();
+
+  // particles of cell1 that are farther away from the whole cell2 than the cutoff can be skipped entirely
+  const size_t begin1 = std::lower_bound(pos1Begin, pos1End, *pos2Begin - _sortingCutoff) - pos1Begin;
+  const size_t end1 = std::upper_bound(pos1Begin, pos1End, *(pos2End - 1) + _sortingCutoff) - pos1Begin;
+
+  for (size_t blockBegin = begin1; blockBegin < end1; blockBegin += _sortedSoAWindowBlockSize) {
+    const size_t blockEnd = std::min(blockBegin + _sortedSoAWindowBlockSize, end1);
+    const auto windowBegin = std::lower_bound(pos2Begin, pos2End, pos1Begin[blockBegin] - _sortingCutoff);
+    const auto windowEnd = std::upper_bound(windowBegin, pos2End, pos1Begin[blockEnd - 1] + _sortingCutoff);
+    if (windowBegin == windowEnd) {
+      continue;
+    }
+    SoAView<typename ParticleCell::SoAArraysType> view1(&soa1, blockBegin, blockEnd);
+    SoAView<typename ParticleCell::SoAArraysType> view2(&soa2, windowBegin - pos2Begin, windowEnd - pos2Begin);
+
+    _functor->SoAFunctorPair(view1, view2, newton3);
+    if constexpr (bidirectional) {
+      if (not newton3) {
+        _functor->SoAFunctorPair(view2, view1, false);
+      }
+    }
+  }
+}
+
 template <class ParticleCell, class ParticleFunctor, bool bidirectional>
 void CellFunctor<ParticleCell, ParticleFunctor, bidirectional>::processCellSoAN3(ParticleCell &cell) {
   _functor->SoAFunctorSingle(cell._particleSoABuffer, true);
@@ -106,6 +106,7 @@ class Functor {
    * be ensured before the call that there is sufficient capacity in the SoA.
    * @note The parameter skipSoAResize is usually set to false, only for VerletListsCellBased Containers it is set to
    * true, since they resize the SoA before the call to SoALoader.
+   * @note When resizing, only the arrays of getNeededAttr() are allocated, all other arrays of the SoA are released.
    * @tparam ParticleCell Type of the cell.
    */
   template <class ParticleCell>
@@ -203,7 +204,13 @@ class Functor {
   void SoALoaderImpl(cell_t &cell, ::autopas::SoA<SoAArraysType> &soa, size_t offset, bool skipSoAResize,
                      std::index_sequence<I...>) {
     if (not skipSoAResize) {
-      soa.resizeArrays(offset + cell.size());
+      if constexpr (sizeof...(I) == 0) {
+        // functor does not declare what it needs, so provide everything
+        soa.resizeArrays(offset + cell.size());
+      } else {
+        // only allocate the columns the functor actually reads or writes
+        soa.template resizeArrays<Functor_T::getNeededAttr()[I]...>(offset + cell.size());
+      }
     }
 
     if (cell.isEmpty()) return;
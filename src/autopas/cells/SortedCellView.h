@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <vector>
 
 #include "autopas/cells/FullParticleCell.h"
@@ -16,6 +18,35 @@
 
 namespace autopas {
 
+/**
+ * Dimension along which the SoA buffers of cells are sorted if sorted SoA windows are used.
+ * This is the dimension of the longest cell side. Ties are resolved to the lower dimension.
+ * @param cellLength Side lengths of the cell.
+ * @return Dimension (0 = x, 1 = y, 2 = z) along which to sort.
+ */
+inline size_t sortedSoAWindowDimension(const std::array<double, 3> &cellLength) {
+  return std::distance(cellLength.begin(), std::max_element(cellLength.begin(), cellLength.end()));
+}
+
+/**
+ * Checks at compile time if sorted SoA windows can be used with the given functor. This requires the functor to load
+ * all positions into the SoA, because the windows are found via the positions along the sorting dimension.
+ * @tparam ParticleFunctor
+ * @tparam Particle
+ * @return True if posX, posY and posZ are part of ParticleFunctor::getNeededAttr().
+ */
+template <class ParticleFunctor, class Particle>
+constexpr bool functorSupportsSortedSoAWindows() {
+  using AttributeNames = typename Particle::AttributeNames;
+  bool loadsX = false, loadsY = false, loadsZ = false;
+  for (const auto attr : ParticleFunctor::getNeededAttr()) {
+    loadsX = loadsX or attr == AttributeNames::posX;
+    loadsY = loadsY or attr == AttributeNames::posY;
+    loadsZ = loadsZ or attr == AttributeNames::posZ;
+  }
+  return loadsX and loadsY and loadsZ;
+}
+
 /**
  * This class defines a sorted view on a given ParticleCell. Particles are sorted along the normalized vector r.
  * \image html SortingPrinciple.png "Projection of particles in 2D"
@@ -142,6 +142,13 @@ class CellBasedParticleContainer : public ParticleContainerInterface<typename Pa
     return numParticles;
   }
 
+  /**
+   * @copydoc autopas::ParticleContainerInterface::getMemoryEstimate()
+   */
+  [[nodiscard]] size_t getMemoryEstimate() const override {
+    return ParticleContainerInterface<Particle>::getMemoryEstimate() + _cells.capacity() * sizeof(ParticleCell);
+  }
+
   /**
    * Get immutable vector of cells.
    * @return immutable reference to _cells
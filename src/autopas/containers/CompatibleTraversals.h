@@ -173,6 +173,35 @@ std::set<TraversalOption> filterAllOptions(const std::string &prefix, const Inte
       TraversalOption::lc_c04_combined_SoA,
   };
 };
+/**
+ * Provides a set of all traversals whose dynamically scheduled OpenMP loops use the chunk size of the configuration.
+ * All other traversals are statically scheduled or not parallelized and therefore ignore it.
+ * @return
+ */
+[[maybe_unused]] static std::set<TraversalOption> allTraversalsSupportingChunkSize() {
+  return {TraversalOption::lc_c01,
+          TraversalOption::lc_c01_combined_SoA,
+          TraversalOption::lc_c04,
+          TraversalOption::lc_c04_HCP,
+          TraversalOption::lc_c04_combined_SoA,
+          TraversalOption::lc_c08,
+          TraversalOption::lc_c18,
+          TraversalOption::lc_sliced,
+          TraversalOption::lc_sliced_c02,
+          TraversalOption::vcl_c06,
+          TraversalOption::vcl_sliced,
+          TraversalOption::vcl_sliced_c02,
+          TraversalOption::vlc_c01,
+          TraversalOption::vlc_c08,
+          TraversalOption::vlc_c18,
+          TraversalOption::vlc_sliced,
+          TraversalOption::vlc_sliced_c02,
+          TraversalOption::vlp_c01,
+          TraversalOption::vlp_c08,
+          TraversalOption::vlp_c18,
+          TraversalOption::vlp_sliced,
+          TraversalOption::vlp_sliced_c02};
+};
 
 /**
  * Lists all traversal options applicable for the given container.
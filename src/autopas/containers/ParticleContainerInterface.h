@@ -7,7 +7,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <vector>
 
 #include "autopas/cells/ParticleCell.h"
@@ -108,6 +110,22 @@ class ParticleContainerInterface {
   };
 
  protected:
+  /**
+   * Estimates the memory of neighbor lists that store a pointer to every particle within the interaction length of
+   * every particle. Particles are assumed to be distributed homogeneously.
+   * @return Estimate in bytes.
+   */
+  [[nodiscard]] size_t estimateNeighborListMemory() const {
+    const auto &boxMin = getBoxMin();
+    const auto &boxMax = getBoxMax();
+    const auto boxVolume = (boxMax[0] - boxMin[0]) * (boxMax[1] - boxMin[1]) * (boxMax[2] - boxMin[2]);
+    const auto interactionLength = getInteractionLength();
+    const auto sphereVolume = 4. / 3. * M_PI * interactionLength * interactionLength * interactionLength;
+    const auto numParticles = static_cast<double>(size());
+    const auto numNeighborsPerParticle = numParticles * std::min(1., sphereVolume / boxVolume);
+    return static_cast<size_t>(numParticles * numNeighborsPerParticle) * sizeof(Particle *);
+  }
+
   /**
    * Adds a particle to the container.
    * This is an unsafe version of addParticle() and does not perform a boundary check.
@@ -189,6 +207,16 @@ class ParticleContainerInterface {
    */
   [[nodiscard]] virtual size_t size() const = 0;
 
+  /**
+   * Estimates the memory the container occupies.
+   * This covers the particles and their SoA buffers. Containers add their cells and neighbor lists.
+   * @return Estimate in bytes.
+   */
+  [[nodiscard]] virtual size_t getMemoryEstimate() const {
+    // The SoA buffers hold a second copy of the particle data.
+    return 2 * size() * sizeof(Particle);
+  }
+
   /**
    * Iterate over all particles using
    * for(auto iter = container.begin(); iter.isValid(); ++iter) .
@@ -68,6 +68,31 @@ class TraversalInterface {
    */
   [[nodiscard]] DataLayoutOption getDataLayout() const { return _dataLayout; }
 
+  /**
+   * Set the chunk size of the dynamically scheduled OpenMP loops of this traversal.
+   * @param chunkSize Zero restores the default chunk size of 1.
+   */
+  void setChunkSize(unsigned int chunkSize) { _chunkSize = chunkSize == 0 ? 1 : static_cast<int>(chunkSize); }
+
+  /**
+   * Return the chunk size of the dynamically scheduled OpenMP loops of this traversal.
+   * @return
+   */
+  [[nodiscard]] int getChunkSize() const { return _chunkSize; }
+
+  /**
+   * Set the number of OpenMP threads this traversal is executed with.
+   * Traversals that partition the domain by the number of threads use this instead of querying OpenMP.
+   * @param numThreads Zero stands for all available threads.
+   */
+  void setNumThreads(unsigned int numThreads) { _numThreads = numThreads; }
+
+  /**
+   * Return the number of OpenMP threads this traversal is executed with.
+   * @return Zero if all available threads are used.
+   */
+  [[nodiscard]] unsigned int getNumThreads() const { return _numThreads; }
+
  protected:
   /**
    * The datalayout used by this traversal.
@@ -78,5 +103,15 @@ class TraversalInterface {
    * If this traversal makes use of newton3.
    */
   bool _useNewton3;
+
+  /**
+   * Chunk size of the dynamically scheduled OpenMP loops.
+   */
+  int _chunkSize{1};
+
+  /**
+   * Number of OpenMP threads this traversal is executed with. Zero stands for all available threads.
+   */
+  unsigned int _numThreads{0};
 };
 }  // namespace autopas
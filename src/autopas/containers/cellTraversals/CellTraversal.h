@@ -7,9 +7,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <limits>
 #include <vector>
 
+#include "autopas/cells/SortedCellView.h"
+#include "autopas/options/DataLayoutOption.h"
+
 namespace autopas {
 
 /**
@@ -47,7 +52,69 @@ class CellTraversal {
    */
   virtual void setSortingThreshold(size_t sortingThreshold) = 0;
 
+  /**
+   * Enable or disable sorted SoA windows for traversals that use the CellFunctor.
+   * If enabled, the particles of cells are sorted along sortedSoAWindowDimension() before the SoA buffers are loaded,
+   * so that the CellFunctor only passes windows of particles that are within the cutoff to SoAFunctorPair. Only cells
+   * that can be part of a pair above the sorting threshold are sorted, because all other pairs are processed without
+   * windows. Traversals that do not support this keep the default implementation, which ignores the setting.
+   * @param useSortedSoAWindows
+   */
+  virtual void setUseSortedSoAWindows(bool useSortedSoAWindows) {}
+
  protected:
+  /**
+   * Loads the data layout of the given cell via the given converter.
+   * If the cell has at least minCellSizeToSort particles, it is sorted for sorted SoA windows before its SoA buffer is
+   * loaded.
+   * @tparam DataLayoutConverterType
+   * @param cell
+   * @param dataLayoutConverter
+   * @param dataLayout Data layout of the traversal.
+   * @param minCellSizeToSort Result of minCellSizeForSortedSoAWindows().
+   */
+  template <class DataLayoutConverterType>
+  void loadDataLayoutOfCell(ParticleCell &cell, DataLayoutConverterType &dataLayoutConverter,
+                            DataLayoutOption dataLayout, size_t minCellSizeToSort) {
+    if (dataLayout != DataLayoutOption::soa) {
+      return;
+    }
+    if (cell.size() >= minCellSizeToSort) {
+      cell.sortByDim(sortedSoAWindowDimension(cell.getCellLength()));
+    }
+    dataLayoutConverter.loadDataLayout(cell);
+  }
+
+  /**
+   * Number of particles from which a cell has to be sorted before its SoA buffer is loaded.
+   * The CellFunctor only uses sorted SoA windows for a cell pair if the sum of both cell sizes exceeds the sorting
+   * threshold. Hence, a cell only needs to be sorted if this is the case together with the largest cell.
+   * @return Minimal cell size for sorting or the maximal value of size_t if no cell has to be sorted.
+   */
+  [[nodiscard]] size_t minCellSizeForSortedSoAWindows() const {
+    if (not _useSortedSoAWindows or _cells == nullptr) {
+      return std::numeric_limits<size_t>::max();
+    }
+    size_t maxCellSize = 0;
+    for (const auto &cell : *_cells) {
+      maxCellSize = std::max(maxCellSize, cell.size());
+    }
+    const size_t minCellSize = maxCellSize > _sortingThreshold ? 0 : _sortingThreshold - maxCellSize + 1;
+    // sorting fewer than two particles does not change anything
+    return std::max(minCellSize, size_t{2});
+  }
+
+  /**
+   * If true, particles in the cells are sorted before SoAs are loaded. See setUseSortedSoAWindows().
+   */
+  bool _useSortedSoAWindows{false};
+
+  /**
+   * Sorting threshold of the CellFunctor. Used to decide which cells have to be sorted for sorted SoA windows.
+   * Traversals that support sorted SoA windows have to set it in setSortingThreshold().
+   */
+  size_t _sortingThreshold{8};
+
   /**
    * The dimensions of the cellblock.
    * The dimensions are the number of cells in x, y and z direction.
@@ -61,10 +61,11 @@ class ColorBasedTraversal : public CellTraversal<ParticleCell>, public Traversal
   void initTraversal() override {
     if (this->_cells) {
       auto &cells = *(this->_cells);
+      const auto minCellSizeToSort = this->minCellSizeForSortedSoAWindows();
       /// @todo find a condition on when to use omp or when it is just overhead
       AUTOPAS_OPENMP(parallel for)
       for (size_t i = 0; i < cells.size(); ++i) {
-        _dataLayoutConverter.loadDataLayout(cells[i]);
+        this->loadDataLayoutOfCell(cells[i], _dataLayoutConverter, this->_dataLayout, minCellSizeToSort);
       }
     }
   }
@@ -149,7 +150,7 @@ inline void ColorBasedTraversal<ParticleCell, Functor, collapseDepth>::colorTrav
       const unsigned long end_x = end[0], end_y = end[1], end_z = end[2];
       const unsigned long stride_x = stride[0], stride_y = stride[1], stride_z = stride[2];
       if (collapseDepth == 2) {
-        AUTOPAS_OPENMP(for schedule(dynamic, 1) collapse(2))
+        AUTOPAS_OPENMP(for schedule(dynamic, this->_chunkSize) collapse(2))
         for (unsigned long z = start_z; z < end_z; z += stride_z) {
           for (unsigned long y = start_y; y < end_y; y += stride_y) {
             for (unsigned long x = start_x; x < end_x; x += stride_x) {
@@ -159,7 +160,7 @@ inline void ColorBasedTraversal<ParticleCell, Functor, collapseDepth>::colorTrav
           }
         }
       } else {
-        AUTOPAS_OPENMP(for schedule(dynamic, 1) collapse(3))
+        AUTOPAS_OPENMP(for schedule(dynamic, this->_chunkSize) collapse(3))
         for (unsigned long z = start_z; z < end_z; z += stride_z) {
           for (unsigned long y = start_y; y < end_y; y += stride_y) {
             for (unsigned long x = start_x; x < end_x; x += stride_x) {
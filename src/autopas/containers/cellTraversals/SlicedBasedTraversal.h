@@ -129,10 +129,11 @@ class SlicedBasedTraversal : public CellTraversal<ParticleCell>, public Traversa
   virtual void loadDataLayout() {
     if (this->_cells) {
       auto &cells = *(this->_cells);
+      const auto minCellSizeToSort = this->minCellSizeForSortedSoAWindows();
       /// @todo find a condition on when to use omp or when it is just overhead
       AUTOPAS_OPENMP(parallel for)
       for (size_t i = 0; i < cells.size(); ++i) {
-        _dataLayoutConverter.loadDataLayout(cells[i]);
+        this->loadDataLayoutOfCell(cells[i], _dataLayoutConverter, this->_dataLayout, minCellSizeToSort);
       }
     }
   }
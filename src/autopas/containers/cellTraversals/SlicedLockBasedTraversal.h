@@ -83,7 +83,7 @@ void SlicedLockBasedTraversal<ParticleCell, Functor>::slicedTraversal(LoopBody &
 
 #ifdef AUTOPAS_USE_OPENMP
   if (this->_dynamic) {
-    omp_set_schedule(omp_sched_dynamic, 1);
+    omp_set_schedule(omp_sched_dynamic, this->_chunkSize);
   } else {
     omp_set_schedule(omp_sched_static, 1);
   }
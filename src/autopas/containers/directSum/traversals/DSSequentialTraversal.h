@@ -50,8 +50,9 @@ class DSSequentialTraversal : public CellTraversal<ParticleCell>,
 
   void initTraversal() override {
     auto &cells = *(this->_cells);
+    const auto minCellSizeToSort = this->minCellSizeForSortedSoAWindows();
     for (auto &cell : cells) {
-      _dataLayoutConverter.loadDataLayout(cell);
+      this->loadDataLayoutOfCell(cell, _dataLayoutConverter, this->_dataLayout, minCellSizeToSort);
     }
   }
 
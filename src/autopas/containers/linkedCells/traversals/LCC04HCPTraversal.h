@@ -64,7 +64,19 @@ class LCC04HCPTraversal : public C08BasedTraversal<ParticleCell, PairwiseFunctor
   /**
    * @copydoc autopas::CellTraversal::setSortingThreshold()
    */
-  void setSortingThreshold(size_t sortingThreshold) override { _cellHandler.setSortingThreshold(sortingThreshold); }
+  void setSortingThreshold(size_t sortingThreshold) override {
+    this->_sortingThreshold = sortingThreshold;
+    _cellHandler.setSortingThreshold(sortingThreshold);
+  }
+
+  /**
+   * @copydoc autopas::CellTraversal::setUseSortedSoAWindows()
+   */
+  void setUseSortedSoAWindows(bool useSortedSoAWindows) override {
+    this->_useSortedSoAWindows =
+        useSortedSoAWindows and functorSupportsSortedSoAWindows<PairwiseFunctor, typename ParticleCell::ParticleType>();
+    _cellHandler.setUseSortedSoAWindows(useSortedSoAWindows);
+  }
 
  private:
   void traverseSingleColor(std::vector<ParticleCell> &cells, int color);
@@ -160,7 +172,7 @@ void LCC04HCPTraversal<ParticleCell, PairwiseFunctor>::traverseSingleColor(std::
   const long startZ = startOfThisColor[2], endZ = _end[2];
 
   // iterate over cartesian grid
-  AUTOPAS_OPENMP(for schedule(dynamic, 1) collapse(3) nowait)
+  AUTOPAS_OPENMP(for schedule(dynamic, this->_chunkSize) collapse(3) nowait)
   for (long z = startZ; z < endZ; z += 4) {
     for (long y = startY; y < endY; y++) {
       /* color starts every 6th column again, the +4 is needed to prevent ending too early, since it
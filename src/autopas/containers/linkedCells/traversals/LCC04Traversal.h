@@ -69,7 +69,19 @@ class LCC04Traversal : public C08BasedTraversal<ParticleCell, PairwiseFunctor>,
   /**
    * @copydoc autopas::CellTraversal::setSortingThreshold()
    */
-  void setSortingThreshold(size_t sortingThreshold) override { _cellHandler.setSortingThreshold(sortingThreshold); }
+  void setSortingThreshold(size_t sortingThreshold) override {
+    this->_sortingThreshold = sortingThreshold;
+    _cellHandler.setSortingThreshold(sortingThreshold);
+  }
+
+  /**
+   * @copydoc autopas::CellTraversal::setUseSortedSoAWindows()
+   */
+  void setUseSortedSoAWindows(bool useSortedSoAWindows) override {
+    this->_useSortedSoAWindows =
+        useSortedSoAWindows and functorSupportsSortedSoAWindows<PairwiseFunctor, typename ParticleCell::ParticleType>();
+    _cellHandler.setUseSortedSoAWindows(useSortedSoAWindows);
+  }
 
  private:
   void traverseSingleColor(std::vector<ParticleCell> &cells, int color);
@@ -218,7 +230,7 @@ void LCC04Traversal<ParticleCell, PairwiseFunctor>::traverseSingleColor(std::vec
 
   // first cartesian grid
   // grids are interlinked: one grid fills the gaps in the other grid
-  AUTOPAS_OPENMP(for schedule(dynamic, 1) collapse(3) nowait)
+  AUTOPAS_OPENMP(for schedule(dynamic, this->_chunkSize) collapse(3) nowait)
   for (long z = startZ; z < endZ; z += 4) {
     for (long y = startY; y < endY; y += 4) {
       for (long x = startX; x < endX; x += 4) {
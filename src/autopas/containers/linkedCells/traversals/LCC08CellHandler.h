@@ -66,6 +66,11 @@ class LCC08CellHandler {
    */
   void setSortingThreshold(size_t sortingThreshold) { _cellFunctor.setSortingThreshold(sortingThreshold); }
 
+  /**
+   * @copydoc autopas::CellTraversal::setUseSortedSoAWindows()
+   */
+  void setUseSortedSoAWindows(bool useSortedSoAWindows) { _cellFunctor.setUseSortedSoAWindows(useSortedSoAWindows); }
+
  protected:
   /**
    * Pair sets for processBaseCell().
@@ -75,7 +75,19 @@ class LCC18Traversal : public C18BasedTraversal<ParticleCell, PairwiseFunctor>,
   /**
    * @copydoc autopas::CellTraversal::setSortingThreshold()
    */
-  void setSortingThreshold(size_t sortingThreshold) override { _cellFunctor.setSortingThreshold(sortingThreshold); }
+  void setSortingThreshold(size_t sortingThreshold) override {
+    this->_sortingThreshold = sortingThreshold;
+    _cellFunctor.setSortingThreshold(sortingThreshold);
+  }
+
+  /**
+   * @copydoc autopas::CellTraversal::setUseSortedSoAWindows()
+   */
+  void setUseSortedSoAWindows(bool useSortedSoAWindows) override {
+    this->_useSortedSoAWindows =
+        useSortedSoAWindows and functorSupportsSortedSoAWindows<PairwiseFunctor, typename ParticleCell::ParticleType>();
+    _cellFunctor.setUseSortedSoAWindows(useSortedSoAWindows);
+  }
 
  private:
   /**
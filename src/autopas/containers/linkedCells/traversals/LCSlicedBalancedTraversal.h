@@ -60,7 +60,19 @@ class LCSlicedBalancedTraversal : public SlicedBalancedBasedTraversal<ParticleCe
   /**
    * @copydoc autopas::CellTraversal::setSortingThreshold()
    */
-  void setSortingThreshold(size_t sortingThreshold) override { _cellHandler.setSortingThreshold(sortingThreshold); }
+  void setSortingThreshold(size_t sortingThreshold) override {
+    this->_sortingThreshold = sortingThreshold;
+    _cellHandler.setSortingThreshold(sortingThreshold);
+  }
+
+  /**
+   * @copydoc autopas::CellTraversal::setUseSortedSoAWindows()
+   */
+  void setUseSortedSoAWindows(bool useSortedSoAWindows) override {
+    this->_useSortedSoAWindows =
+        useSortedSoAWindows and functorSupportsSortedSoAWindows<PairwiseFunctor, typename ParticleCell::ParticleType>();
+    _cellHandler.setUseSortedSoAWindows(useSortedSoAWindows);
+  }
 
  private:
   LCC08CellHandler<ParticleCell, PairwiseFunctor> _cellHandler;
@@ -812,6 +812,16 @@ class VerletClusterLists : public ParticleContainerInterface<Particle>, public i
     return sum;
   }
 
+  /**
+   * @copydoc autopas::ParticleContainerInterface::getMemoryEstimate()
+   */
+  [[nodiscard]] size_t getMemoryEstimate() const override {
+    // Neighbor lists are stored per cluster and point to clusters.
+    return ParticleContainerInterface<Particle>::getMemoryEstimate() +
+           _towerBlock.size() * sizeof(internal::ClusterTower<Particle>) +
+           this->estimateNeighborListMemory() / (_clusterSize * _clusterSize);
+  }
+
   /**
    * @copydoc autopas::ParticleContainerInterface::getNumberOfParticles()
    */
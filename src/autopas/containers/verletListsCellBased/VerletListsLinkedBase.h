@@ -91,6 +91,13 @@ class VerletListsLinkedBase : public ParticleContainerInterface<Particle> {
    */
   size_t size() const override { return _linkedCells.size(); }
 
+  /**
+   * @copydoc autopas::ParticleContainerInterface::getMemoryEstimate()
+   */
+  [[nodiscard]] size_t getMemoryEstimate() const override {
+    return _linkedCells.getMemoryEstimate() + this->estimateNeighborListMemory();
+  }
+
   /**
    * @copydoc autopas::ParticleContainerInterface::getNumberOfParticles()
    */
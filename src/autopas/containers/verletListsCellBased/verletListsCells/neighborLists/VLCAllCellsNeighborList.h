@@ -119,8 +119,15 @@ class VLCAllCellsNeighborList : public VLCNeighborListInterface<Particle> {
       return estimate;
     };
 
+    // Keep the memory of the previous lists so that the rebuild does not have to allocate every list again.
+    for (auto &cellLists : _aosNeighborList) {
+      for (auto &[particlePtr, neighbors] : cellLists) {
+        this->recycleNeighborList(neighbors);
+      }
+      cellLists.clear();
+    }
+
     // Initialize a map of neighbor lists for each cell.
-    _aosNeighborList.clear();
     const size_t numCells = cells.size();
     _aosNeighborList.resize(numCells);
     for (size_t cellIndex = 0; cellIndex < numCells; ++cellIndex) {
@@ -138,7 +145,7 @@ class VLCAllCellsNeighborList : public VLCNeighborListInterface<Particle> {
       size_t particleIndexWithinCell = 0;
       for (auto iter = cell.begin(); iter != cell.end(); ++iter, ++particleIndexWithinCell) {
         Particle *particle = &*iter;
-        _aosNeighborList[cellIndex].emplace_back(particle, std::vector<Particle *>());
+        _aosNeighborList[cellIndex].emplace_back(particle, this->getRecycledNeighborList());
         _aosNeighborList[cellIndex].back().second.reserve(listLengthEstimate);
         _particleToCellMap[particle] = std::make_pair(cellIndex, particleIndexWithinCell);
       }
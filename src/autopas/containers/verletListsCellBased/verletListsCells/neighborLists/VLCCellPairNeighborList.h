@@ -83,7 +83,15 @@ class VLCCellPairNeighborList : public VLCNeighborListInterface<Particle> {
                             double interactionLength, const TraversalOption vlcTraversalOpt,
                             typename VerletListsCellsHelpers::VLCBuildType buildType) override {
     this->_internalLinkedCells = &linkedCells;
-    _aosNeighborList.clear();
+    // Keep the memory of the previous lists so that the rebuild does not have to allocate every list again.
+    for (auto &cellPairs : _aosNeighborList) {
+      for (auto &cellPair : cellPairs) {
+        for (auto &[particlePtr, neighbors] : cellPair) {
+          this->recycleNeighborList(neighbors);
+        }
+        cellPair.clear();
+      }
+    }
     _globalToLocalIndex.clear();
     _particleToCellMap.clear();
     auto &cells = linkedCells.getCells();
@@ -134,7 +142,7 @@ class VLCCellPairNeighborList : public VLCNeighborListInterface<Particle> {
         size_t particleIndexCurrentCell = 0;
         for (auto &particle : cells[firstCellIndex]) {
           // for each particle in cell1 make a pair of particle and neighbor list
-          cellPair.emplace_back(std::make_pair(&particle, std::vector<Particle *>()));
+          cellPair.emplace_back(&particle, this->getRecycledNeighborList());
 
           // add a pair of cell's index and particle's index in the cell
           _particleToCellMap[&particle] = std::make_pair(firstCellIndex, particleIndexCurrentCell);
@@ -138,6 +138,35 @@ class VLCNeighborListInterface {
   virtual void applyBuildFunctor(LinkedCells<Particle> &linkedCells, bool useNewton3, double cutoff, double skin,
                                  double interactionLength, const TraversalOption &vlcTraversalOpt,
                                  typename VerletListsCellsHelpers::VLCBuildType buildType) = 0;
+
+  /**
+   * Empties the given list and keeps its memory for the next rebuild.
+   * @param list Neighbor list that is no longer needed.
+   */
+  void recycleNeighborList(std::vector<Particle *> &list) {
+    list.clear();
+    _recycledNeighborLists.push_back(std::move(list));
+  }
+
+  /**
+   * Returns an empty list, reusing the memory of a previously recycled one if available.
+   * This avoids a heap allocation per particle on every rebuild.
+   * @return Empty neighbor list.
+   */
+  std::vector<Particle *> getRecycledNeighborList() {
+    if (_recycledNeighborLists.empty()) {
+      return {};
+    }
+    auto list = std::move(_recycledNeighborLists.back());
+    _recycledNeighborLists.pop_back();
+    return list;
+  }
+
+ private:
+  /**
+   * Emptied neighbor lists from previous builds whose memory is reused.
+   */
+  std::vector<std::vector<Particle *>> _recycledNeighborLists{};
 };
 
 }  // namespace autopas
@@ -37,6 +37,20 @@ class TuningMetricOption : public Option<TuningMetricOption> {
      * Optimize for least energy usage times delta time
      */
     energyDelayProduct,
+    /**
+     * Optimize for least CPU cycles. Requires hardware counters.
+     */
+    cycles,
+    /**
+     * Optimize for least last level cache misses, e.g. to keep memory bandwidth free for co-scheduled jobs. Requires
+     * hardware counters.
+     */
+    llcMisses,
+    /**
+     * Optimize for least energy usage among all configurations that are at most maxSlowdown slower than the fastest
+     * one. Energy samples are normalized by the CPU frequency.
+     */
+    energyBoundedSlowdown,
   };
 
   /**
@@ -72,6 +86,9 @@ class TuningMetricOption : public Option<TuningMetricOption> {
         {TuningMetricOption::energy, "energy"},
         {TuningMetricOption::energyPerFLOP, "energyPerFLOP"},
         {TuningMetricOption::energyDelayProduct, "energyDelayProduct"},
+        {TuningMetricOption::cycles, "cycles"},
+        {TuningMetricOption::llcMisses, "llcMisses"},
+        {TuningMetricOption::energyBoundedSlowdown, "energyBoundedSlowdown"},
     };
   };
 
@@ -77,6 +77,15 @@ class TuningStrategyOption : public Option<TuningStrategyOption> {
      * Sort the queue by Name (=Configuration::operator<()) to minimize container conversion overhead.
      */
     sortByName,
+    /**
+     * Reuses tuning results of previous runs in similar scenarios from an on-disk database and records new ones.
+     */
+    tuningDatabase,
+    /**
+     * Ranks and prunes the queue by a regression model of the runtime that generalizes across scenarios via LiveInfo
+     * features. Can be trained offline from tuning logs.
+     */
+    regressionCostModel,
   };
 
   /**
@@ -129,6 +138,8 @@ class TuningStrategyOption : public Option<TuningStrategyOption> {
         {TuningStrategyOption::tuningStrategyLogger, "tuning-strategy-logger"},
         {TuningStrategyOption::sortByName, "sort-by-name"},
         {TuningStrategyOption::mpiDivideAndConquer, "mpi-divide-and-conquer"},
+        {TuningStrategyOption::tuningDatabase, "tuning-database"},
+        {TuningStrategyOption::regressionCostModel, "regression-cost-model"},
     };
   }
 
@@ -7,6 +7,8 @@
 #include "AutoTuner.h"
 
 #include <algorithm>
+#include <array>
+#include <cmath>
 #include <iterator>
 #include <numeric>
 #include <vector>
@@ -23,12 +25,25 @@ AutoTuner::AutoTuner(TuningStrategiesListType &tuningStrategies, const SearchSpa
                      const AutoTunerInfo &autoTunerInfo, unsigned int rebuildFrequency, const std::string &outputSuffix)
     : _selectorStrategy(autoTunerInfo.selectorStrategy),
       _tuningStrategies(std::move(tuningStrategies)),
-      _tuningInterval(autoTunerInfo.tuningInterval),
+      // Continuous tuning only starts the very first tuning phase regularly.
+      _tuningInterval(autoTunerInfo.explorationInterval > 0 ? std::numeric_limits<size_t>::max()
+                                                             : autoTunerInfo.tuningInterval),
       _tuningMetric(autoTunerInfo.tuningMetric),
       _useLOESSSmoothening(autoTunerInfo.useLOESSSmoothening),
       _energyMeasurementPossible(initEnergy()),
+      _frequencyMeasurementPossible(initFrequency()),
+      _perfCounterMeasurementPossible(initPerfCounters()),
       _rebuildFrequency(rebuildFrequency),
       _maxSamples(autoTunerInfo.maxSamples),
+      _earlyStoppingFactor(autoTunerInfo.earlyStoppingFactor),
+      _maxAdaptiveSamples(autoTunerInfo.maxAdaptiveSamples),
+      _currentMaxSamples(autoTunerInfo.maxSamples),
+      _explorationInterval(autoTunerInfo.explorationInterval),
+      _driftThreshold(autoTunerInfo.driftThreshold),
+      _retuneOnDrift(autoTunerInfo.retuneOnDrift),
+      _scenarioDriftThreshold(autoTunerInfo.scenarioDriftThreshold),
+      _considerSwitchCosts(autoTunerInfo.considerSwitchCosts),
+      _maxSlowdown(autoTunerInfo.maxSlowdown),
       _needsHomogeneityAndMaxDensity(std::transform_reduce(
           _tuningStrategies.begin(), _tuningStrategies.end(), false, std::logical_or(),
           [](auto &tuningStrat) { return tuningStrat->needsSmoothedHomogeneityAndMaxDensity(); })),
@@ -64,7 +79,12 @@ void AutoTuner::logTuningResult(bool tuningIteration, long tuningTime) const {
   // only log if we are at the end of a tuning phase
   if (_endOfTuningPhase) {
     // This string is part of several older scripts, hence it is not recommended to change it.
-    const auto [conf, optimalEvidence] = _evidenceCollection.getLatestOptimalConfiguration();
+    // The selected configuration is not necessarily the one with the best evidence if switch costs are considered.
+    const auto *selectedEvidence = _evidenceCollection.getEvidence(getCurrentConfig());
+    const auto [conf, optimalEvidence] =
+        selectedEvidence != nullptr and not selectedEvidence->empty()
+            ? std::tuple<Configuration, Evidence>{getCurrentConfig(), selectedEvidence->back()}
+            : _evidenceCollection.getLatestOptimalConfiguration();
     AutoPasLog(DEBUG, "Selected Configuration {}", conf.toString());
     _tuningResultLogger.logTuningResult(conf, _iteration, tuningTime, optimalEvidence.value);
   }
@@ -78,6 +98,7 @@ void AutoTuner::forceRetune() {
   if (inTuningPhase()) {
     AutoPasLog(WARN, "Warning: Currently running tuning phase is aborted a new one is started!");
   }
+  _currentMaxSamples = _maxSamples;
   _samplesNotRebuildingNeighborLists.resize(_maxSamples);
   _forceRetune = true;
   _iterationBaseline = 0;
@@ -93,6 +114,10 @@ bool AutoTuner::tuneConfiguration() {
   // We plan to test a new config so clear all samples.
   _samplesNotRebuildingNeighborLists.clear();
   _samplesRebuildingNeighborLists.clear();
+  _timeSamplesNotRebuildingNeighborLists.clear();
+  _timeSamplesRebuildingNeighborLists.clear();
+  _currentMaxSamples = _maxSamples;
+  _speculativeReferenceSampled = false;
 
   // Helper function to reset the ConfigQueue if something wipes it.
   auto restoreConfigQueueIfEmpty = [&](const auto &configQueueBackup, const TuningStrategyOption &stratOpt) {
@@ -108,17 +133,38 @@ bool AutoTuner::tuneConfiguration() {
   // Determine where in a tuning phase we are
   // If _iterationsInMostRecentTuningPhase >= _tuningInterval the current tuning phase takes more iterations than the
   // tuning interval -> continue tuning
-  if ((_iteration % _tuningInterval == 0 and not _isTuning) or _forceRetune) {
+  if (_explorationPending) {
+    // CASE: Start of an exploration step in continuous tuning. Only a single configuration is sampled and the
+    // strategies are not involved.
+    _explorationPending = false;
+    _isTuning = true;
+    _isExploring = true;
+    _iterationBaseline = 0;
+    const auto bestKnownEvidence = std::get<1>(getBestKnownConfiguration());
+    _bestEvidenceValueInTuningPhase = bestKnownEvidence.value;
+    _bestEvidenceHalfWidthInTuningPhase = confidenceHalfWidth(bestKnownEvidence.variance, bestKnownEvidence.numSamples);
+    _configQueue = {selectExplorationCandidate()};
+    AutoPasLog(DEBUG, "Exploring {}", _configQueue.back().toShortString());
+  } else if ((_iteration % _tuningInterval == 0 and not _isTuning and not _tuningPhasePostponed) or _forceRetune) {
     // CASE: Start of a new tuning phase
     _isTuning = true;
     _forceRetune = false;
+    _driftDetected = false;
     _iterationBaseline = 0;
+    _bestEvidenceValueInTuningPhase = std::numeric_limits<long>::max();
+    _bestEvidenceHalfWidthInTuningPhase = std::numeric_limits<double>::quiet_NaN();
+    _speculativeEstimates.clear();
     // in the first iteration of a tuning phase we reset all strategies
     // and refill the queue with the complete search space.
     // Reverse the order, because _configQueue is FiLo, and we aim to keep the order for legacy reasons.
     _configQueue.clear();
     _configQueue.reserve(_searchSpace.size());
-    std::copy(_searchSpace.rbegin(), _searchSpace.rend(), std::back_inserter(_configQueue));
+    // Configurations that are known to be not applicable are left out, unless nothing else is left.
+    std::copy_if(_searchSpace.rbegin(), _searchSpace.rend(), std::back_inserter(_configQueue),
+                 [&](const auto &conf) { return _inapplicableConfigurations.count(conf) == 0; });
+    if (_configQueue.empty()) {
+      std::copy(_searchSpace.rbegin(), _searchSpace.rend(), std::back_inserter(_configQueue));
+    }
     AutoPasLog(DEBUG, "ConfigQueue at tuneConfiguration before reset: (Size={}) {}", _configQueue.size(),
                utils::ArrayUtils::to_string(_configQueue, ", ", {"[", "]"},
                                             [](const auto &conf) { return conf.toShortString(false); }));
@@ -154,28 +200,65 @@ bool AutoTuner::tuneConfiguration() {
   }
 
   // CASE: End of a tuning phase. This is not exclusive to the other cases!
-  if (_configQueue.empty()) {
+  if (_configQueue.empty() and _isExploring) {
+    endExploration();
+  } else if (_configQueue.empty()) {
     // If the queue is empty we are done tuning.
     _endOfTuningPhase = true;
-    const auto [optConf, optEvidence] = _evidenceCollection.getOptimalConfiguration(_tuningPhase);
+    const auto [optConf, optEvidence] = selectOptimalConfiguration();
     _configQueue.push_back(optConf);
     _isTuning = false;
     // Fill up sample buffer to indicate we are not collecting samples anymore.
     _samplesRebuildingNeighborLists.resize(_maxSamples);
     _iterationBaseline = 0;
+    _iterationsSinceExploration = 0;
+    _nonTuningSamples.clear();
+    _nonTuningReferenceValue.reset();
+    _scenarioReference.reset();
+    _speculativeEstimates.clear();
+  } else if (not _isExploring) {
+    // A configuration whose speculative estimate is already hopeless compared to the best configuration of this phase
+    // is skipped. The estimate itself never becomes evidence.
+    const auto estimateIter = _speculativeEstimates.find(_configQueue.back());
+    if (estimateIter != _speculativeEstimates.end()) {
+      const auto [referenceConfig, ratio] = estimateIter->second;
+      _speculativeEstimates.erase(estimateIter);
+      const auto *referenceEvidence = _evidenceCollection.getEvidence(referenceConfig);
+      if (referenceEvidence and referenceEvidence->back().tuningPhase == _tuningPhase and
+          _bestEvidenceValueInTuningPhase != std::numeric_limits<long>::max()) {
+        const auto estimate = ratio * static_cast<double>(referenceEvidence->back().value);
+        if (estimate > _earlyStoppingFactor * static_cast<double>(_bestEvidenceValueInTuningPhase)) {
+          AutoPasLog(DEBUG, "Skipping {}. Speculative estimate {} exceeds {} x best evidence {}.",
+                     _configQueue.back().toShortString(), estimate, _earlyStoppingFactor,
+                     _bestEvidenceValueInTuningPhase);
+          tuningTimer.stop();
+          return tuneConfiguration();
+        }
+      }
+    }
   }
   tuningTimer.stop();
 
   return _isTuning;
 }
 
+void AutoTuner::setInapplicableConfigurations(SearchSpaceType inapplicableConfigurations) {
+  AutoPasLog(DEBUG, "{} configurations are not applicable in the current domain: {}",
+             inapplicableConfigurations.size(),
+             utils::ArrayUtils::to_string(inapplicableConfigurations, ", ", {"[", "]"},
+                                          [](const auto &conf) { return conf.toShortString(false); }));
+  _inapplicableConfigurations = std::move(inapplicableConfigurations);
+}
+
+const AutoTuner::SearchSpaceType &AutoTuner::getSearchSpace() const { return _searchSpace; }
+
 const Configuration &AutoTuner::getCurrentConfig() const { return _configQueue.back(); }
 
 std::tuple<Configuration, bool> AutoTuner::getNextConfig() {
   // If we are not (yet) tuning or there is nothing to tune return immediately.
   if (not inTuningPhase()) {
     return {getCurrentConfig(), false};
-  } else if (getCurrentNumSamples() < _maxSamples) {
+  } else if (getCurrentNumSamples() < _currentMaxSamples) {
     // If we are still collecting samples from one config return immediately.
     return {getCurrentConfig(), true};
   } else {
@@ -218,14 +301,19 @@ std::tuple<Configuration, bool> AutoTuner::rejectConfig(const Configuration &rej
                utils::ArrayUtils::to_string(_configQueue, ", ", {"[", "]"},
                                             [](const auto &conf) { return conf.toShortString(false); }));
   });
+  if (_isExploring and _configQueue.empty()) {
+    // The exploration candidate can not be used, so continue with the best known configuration.
+    endExploration();
+    return {getCurrentConfig(), false};
+  }
   const auto stillTuning = not _configQueue.empty();
   return {getCurrentConfig(), stillTuning};
 }
 
-void AutoTuner::addMeasurement(long sample, bool neighborListRebuilt) {
+void AutoTuner::addMeasurement(long sample, bool neighborListRebuilt, long timeSample) {
   const auto &currentConfig = _configQueue.back();
   // sanity check
-  if (getCurrentNumSamples() >= _maxSamples) {
+  if (getCurrentNumSamples() >= _currentMaxSamples) {
     utils::ExceptionHandler::exception(
         "AutoTuner::addMeasurement(): Trying to add a new measurement to the AutoTuner but there are already enough "
         "for this configuration!\n"
@@ -237,13 +325,70 @@ void AutoTuner::addMeasurement(long sample, bool neighborListRebuilt) {
   } else {
     _samplesNotRebuildingNeighborLists.push_back(sample);
   }
+  const bool boundedSlowdown = _tuningMetric == TuningMetricOption::energyBoundedSlowdown;
+  if (boundedSlowdown) {
+    (neighborListRebuilt ? _timeSamplesRebuildingNeighborLists : _timeSamplesNotRebuildingNeighborLists)
+        .push_back(timeSample);
+  }
+  // If the samples so far are already hopeless compared to the best configuration of this phase, don't waste
+  // iterations on collecting the rest of them. With a bounded slowdown, the configuration with the least energy
+  // consumption might be too slow, so nothing can be judged before all samples are there. Without a sample of an
+  // iteration that does not rebuild, the estimate charges the rebuild to every iteration, which overestimates
+  // configurations with expensive rebuilds, so nothing can be judged either.
+  const long reducedValue = estimateRuntimeFromSamples();
+  const auto [variance, numVarianceSamples] = estimateVarianceFromSamples();
+  const auto numCollectedSamples = getCurrentNumSamples();
+  const bool estimateIsAmortized = not _samplesNotRebuildingNeighborLists.empty();
+  const bool hopeless = not boundedSlowdown and estimateIsAmortized and numCollectedSamples < _currentMaxSamples and
+                        static_cast<double>(reducedValue) >
+                            _earlyStoppingFactor * static_cast<double>(_bestEvidenceValueInTuningPhase);
+  if (hopeless) {
+    AutoPasLog(DEBUG, "Stopping sampling of {} after {} of {} samples. Estimate {} exceeds {} x best evidence {}.",
+               currentConfig.toShortString(), numCollectedSamples, _currentMaxSamples, reducedValue,
+               _earlyStoppingFactor, _bestEvidenceValueInTuningPhase);
+  }
+
+  // Adaptive sampling compares the 95% confidence intervals of this configuration and the best one of the phase. As
+  // long as there are not enough samples for a variance of its own, the relative width of the best configuration's
+  // interval is used. Unknown widths are NaN, so all comparisons below are false and nothing is decided. Like above,
+  // a configuration is only declared dominated once its estimate is amortized.
+  const bool adaptiveSampling = not boundedSlowdown and _maxAdaptiveSamples > _maxSamples and
+                                _bestEvidenceValueInTuningPhase != std::numeric_limits<long>::max();
+  const auto estimate = static_cast<double>(reducedValue);
+  const auto bestValue = static_cast<double>(_bestEvidenceValueInTuningPhase);
+  const auto halfWidth = numVarianceSamples >= 2 ? confidenceHalfWidth(variance, numVarianceSamples)
+                                                 : _bestEvidenceHalfWidthInTuningPhase / bestValue * estimate;
+  const bool dominated = estimate - halfWidth > bestValue + _bestEvidenceHalfWidthInTuningPhase;
+  const bool separated = dominated or estimate + halfWidth < bestValue - _bestEvidenceHalfWidthInTuningPhase;
+  const bool stopDominated = adaptiveSampling and estimateIsAmortized and not hopeless and
+                             numCollectedSamples < _currentMaxSamples and dominated;
+  if (stopDominated) {
+    AutoPasLog(DEBUG, "Stopping sampling of {} after {} of {} samples. Estimate {} +- {} is above best {} +- {}.",
+               currentConfig.toShortString(), numCollectedSamples, _currentMaxSamples, reducedValue, halfWidth,
+               _bestEvidenceValueInTuningPhase, _bestEvidenceHalfWidthInTuningPhase);
+  }
+  const bool stopEarly = hopeless or stopDominated;
+  if (adaptiveSampling and numCollectedSamples == _currentMaxSamples and numCollectedSamples < _maxAdaptiveSamples and
+      not separated) {
+    ++_currentMaxSamples;
+    AutoPasLog(TRACE, "Confidence interval of {} ({} +- {}) overlaps with best evidence {} +- {}. Taking sample {}.",
+               currentConfig.toShortString(), reducedValue, halfWidth, _bestEvidenceValueInTuningPhase,
+               _bestEvidenceHalfWidthInTuningPhase, _currentMaxSamples);
+  }
   // if this was the last sample for this configuration:
   //  - calculate the evidence from the collected samples
   //  - log what was collected
   //  - remove the configuration from the queue
-  if (getCurrentNumSamples() == _maxSamples) {
-    const long reducedValue = estimateRuntimeFromSamples();
-    _evidenceCollection.addEvidence(currentConfig, {_iteration, _tuningPhase, reducedValue});
+  const bool lastSample = numCollectedSamples == _currentMaxSamples or stopEarly;
+  if (lastSample) {
+    _evidenceCollection.addEvidence(currentConfig,
+                                    {_iteration, _tuningPhase, reducedValue, variance, numVarianceSamples});
+    if (boundedSlowdown) {
+      _timeEvidenceCollection.addEvidence(
+          currentConfig,
+          {_iteration, _tuningPhase,
+           estimateFromSamples(_timeSamplesRebuildingNeighborLists, _timeSamplesNotRebuildingNeighborLists)});
+    }
 
     // If LOESS-based smoothening is enabled, use it to smooth evidence to remove high outliers. If smoothing results in
     // a higher value or if LOESS-based smoothening is disabled, use the original value.
@@ -272,6 +417,12 @@ void AutoTuner::addMeasurement(long sample, bool neighborListRebuilt) {
               return "energyPerFLOP";
             case TuningMetricOption::energyDelayProduct:
               return "energyDelayProduct";
+            case TuningMetricOption::cycles:
+              return "cycles";
+            case TuningMetricOption::llcMisses:
+              return "LLC misses";
+            case TuningMetricOption::energyBoundedSlowdown:
+              return "energy consumption at bounded slowdown";
           }
           autopas::utils::ExceptionHandler::exception("AutoTuner::addMeasurement(): Unknown tuning metric.");
           return "Unknown tuning metric";
@@ -291,7 +442,248 @@ void AutoTuner::addMeasurement(long sample, bool neighborListRebuilt) {
 
     _tuningDataLogger.logTuningData(currentConfig, _samplesRebuildingNeighborLists, _samplesNotRebuildingNeighborLists,
                                     _iteration, reducedValue, smoothedValue);
+
+    if (smoothedValue < _bestEvidenceValueInTuningPhase) {
+      _bestEvidenceValueInTuningPhase = smoothedValue;
+      _bestEvidenceHalfWidthInTuningPhase = confidenceHalfWidth(variance, numVarianceSamples);
+    }
+  }
+
+  if (stopEarly) {
+    // Fill up sample buffer to indicate we are not collecting samples for this configuration anymore.
+    const auto numSkippedSamples = _currentMaxSamples - numCollectedSamples;
+    _samplesNotRebuildingNeighborLists.resize(_samplesNotRebuildingNeighborLists.size() + numSkippedSamples);
+  }
+  if (lastSample) {
+    // Advance the baseline to the next multiple of _maxSamples, as if exactly that many samples were taken, so the next
+    // configuration starts with a rebuild.
+    _iterationBaseline += (_maxSamples - numCollectedSamples % _maxSamples) % _maxSamples;
+  }
+}
+
+std::optional<Configuration> AutoTuner::getSpeculativeConfig() const {
+  if (not _isTuning or _isExploring or _configQueue.size() < 2 or std::isinf(_earlyStoppingFactor) or
+      _speculativeReferenceSampled or getCurrentNumSamples() != 0) {
+    return std::nullopt;
+  }
+  // Skip the current configuration at the back and everything that already has an estimate.
+  for (auto confIter = std::next(_configQueue.rbegin()); confIter != _configQueue.rend(); ++confIter) {
+    if (_speculativeEstimates.count(*confIter) == 0) {
+      return *confIter;
+    }
+  }
+  return std::nullopt;
+}
+
+void AutoTuner::addSpeculativeMeasurement(const Configuration &configuration, long sample, long referenceSample) {
+  AutoPasLog(TRACE, "Adding speculative sample {} to configuration {} with reference sample {} of {}.", sample,
+             configuration.toShortString(), referenceSample, getCurrentConfig().toShortString());
+  _speculativeReferenceSampled = true;
+  _iterationWithoutSample = true;
+  if (referenceSample > 0) {
+    _speculativeEstimates[configuration] = {getCurrentConfig(),
+                                            static_cast<double>(sample) / static_cast<double>(referenceSample)};
+  }
+}
+
+void AutoTuner::addNonTuningMeasurement(long sample, bool neighborListRebuilt) {
+  // Rebuild iterations are skipped because their share depends on the rebuild frequency and not on the scenario.
+  if (not(tunesContinuously() or _retuneOnDrift) or neighborListRebuilt) {
+    return;
+  }
+  _nonTuningSamples.push_back(sample);
+  if (_nonTuningSamples.size() < _maxSamples) {
+    return;
+  }
+  const auto value = OptimumSelector::optimumValue(_nonTuningSamples, _selectorStrategy);
+  _nonTuningSamples.clear();
+  if (not _nonTuningReferenceValue.has_value()) {
+    _nonTuningReferenceValue = value;
+    return;
+  }
+  const auto reference = static_cast<double>(std::max(*_nonTuningReferenceValue, 1l));
+  const auto relativeChange = std::abs(static_cast<double>(value) - reference) / reference;
+  if (relativeChange > _driftThreshold) {
+    AutoPasLog(DEBUG, "Runtime of {} drifted from {} to {}. Starting a new tuning phase.",
+               getCurrentConfig().toShortString(), *_nonTuningReferenceValue, value);
+    _driftDetected = true;
+  }
+}
+
+bool AutoTuner::tunesContinuously() const { return _explorationInterval > 0; }
+
+void AutoTuner::addScenarioStatistics(double homogeneity, double maxDensity) {
+  if (not _retuneOnDrift) {
+    return;
+  }
+  if (not _scenarioReference.has_value()) {
+    _scenarioReference = {homogeneity, maxDensity};
+    return;
+  }
+  const auto &[referenceHomogeneity, referenceMaxDensity] = *_scenarioReference;
+  // Homogeneity is the standard deviation of the density, so both are compared on the scale of the density.
+  const auto scale = std::max(referenceMaxDensity, std::numeric_limits<double>::min());
+  const auto homogeneityChange = std::abs(homogeneity - referenceHomogeneity) / scale;
+  const auto maxDensityChange = std::abs(maxDensity - referenceMaxDensity) / scale;
+  if (std::max(homogeneityChange, maxDensityChange) > _scenarioDriftThreshold) {
+    AutoPasLog(DEBUG,
+               "Particle distribution drifted from homogeneity {} and max density {} to {} and {}. Starting a new "
+               "tuning phase.",
+               referenceHomogeneity, referenceMaxDensity, homogeneity, maxDensity);
+    _driftDetected = true;
+  }
+}
+
+bool AutoTuner::retunesOnDrift() const { return _retuneOnDrift; }
+
+void AutoTuner::addContainerSwitchCost(const ContainerOption &from, const ContainerOption &to, long time) {
+  AutoPasLog(DEBUG, "Switching from {} to {} took {} ns.", from, to, time);
+  _containerSwitchCosts[{from, to}] = time;
+}
+
+void AutoTuner::setActiveContainer(const ContainerOption &container) { _activeContainer = container; }
+
+const std::map<std::pair<ContainerOption, ContainerOption>, long> &AutoTuner::getContainerSwitchCosts() const {
+  return _containerSwitchCosts;
+}
+
+long AutoTuner::estimateContainerSwitchCost(const ContainerOption &to) const {
+  if (not _activeContainer.has_value() or *_activeContainer == to) {
+    return 0;
+  }
+  const auto measured = _containerSwitchCosts.find({*_activeContainer, to});
+  if (measured != _containerSwitchCosts.end()) {
+    return measured->second;
+  }
+  long sum{0};
+  size_t numSwitches{0};
+  for (const auto &[fromTo, time] : _containerSwitchCosts) {
+    if (fromTo.second == to) {
+      sum += time;
+      ++numSwitches;
+    }
+  }
+  return numSwitches == 0 ? 0 : sum / static_cast<long>(numSwitches);
+}
+
+std::tuple<Configuration, Evidence> AutoTuner::selectOptimalConfiguration() const {
+  auto [optConf, optEvidence] = _evidenceCollection.getOptimalConfiguration(_tuningPhase);
+  if (_tuningMetric == TuningMetricOption::energyBoundedSlowdown) {
+    // Among all configurations that are at most _maxSlowdown slower than the fastest one, take the one that consumes
+    // the least energy.
+    const auto [fastestConf, fastestTime] = _timeEvidenceCollection.getOptimalConfiguration(_tuningPhase);
+    const auto timeBound = static_cast<double>(fastestTime.value) * (1. + _maxSlowdown);
+    optConf = fastestConf;
+    optEvidence = _evidenceCollection.getEvidence(fastestConf)->back();
+    for (const auto &configuration : _searchSpace) {
+      const auto *energyEvidence = _evidenceCollection.getEvidence(configuration);
+      const auto *timeEvidence = _timeEvidenceCollection.getEvidence(configuration);
+      if (energyEvidence == nullptr or energyEvidence->empty() or timeEvidence == nullptr or timeEvidence->empty() or
+          timeEvidence->back().tuningPhase != _tuningPhase) {
+        continue;
+      }
+      if (static_cast<double>(timeEvidence->back().value) <= timeBound and
+          energyEvidence->back().value < optEvidence.value) {
+        optConf = configuration;
+        optEvidence = energyEvidence->back();
+      }
+    }
+    AutoPasLog(DEBUG, "Selecting {} with energy {} within a slowdown of {} of the fastest {} with time {}.",
+               optConf.toShortString(), optEvidence.value, _maxSlowdown, fastestConf.toShortString(),
+               fastestTime.value);
+    return {optConf, optEvidence};
+  }
+  // Switch costs are times, so they can only be weighed against time based evidence.
+  if (not _considerSwitchCosts or _tuningMetric != TuningMetricOption::time or not _activeContainer.has_value()) {
+    return {optConf, optEvidence};
+  }
+
+  // Number of iterations until the next optimum is selected.
+  const auto horizon = static_cast<double>(tunesContinuously() ? _explorationInterval : _tuningInterval);
+  auto expectedTime = [&](const Configuration &configuration, const Evidence &evidence) {
+    return static_cast<double>(evidence.value) * horizon +
+           static_cast<double>(estimateContainerSwitchCost(configuration.container));
+  };
+  const auto fastestConf = optConf;
+  auto optExpectedTime = expectedTime(optConf, optEvidence);
+  for (const auto &configuration : _searchSpace) {
+    const auto *evidence = _evidenceCollection.getEvidence(configuration);
+    if (evidence == nullptr or evidence->empty() or evidence->back().tuningPhase != _tuningPhase) {
+      continue;
+    }
+    const auto configurationExpectedTime = expectedTime(configuration, evidence->back());
+    if (configurationExpectedTime < optExpectedTime) {
+      optConf = configuration;
+      optEvidence = evidence->back();
+      optExpectedTime = configurationExpectedTime;
+    }
+  }
+  if (optConf != fastestConf) {
+    AutoPasLog(DEBUG, "Selecting {} instead of the fastest {} because the switch does not pay off in {} iterations.",
+               optConf.toShortString(), fastestConf.toShortString(), horizon);
+  }
+  return {optConf, optEvidence};
+}
+
+std::tuple<Configuration, Evidence> AutoTuner::getBestKnownConfiguration() const {
+  Configuration bestConfig{};
+  Evidence bestEvidence{0, 0, std::numeric_limits<decltype(Evidence::value)>::max()};
+  for (const auto &configuration : _searchSpace) {
+    const auto *evidence = _evidenceCollection.getEvidence(configuration);
+    if (evidence != nullptr and not evidence->empty() and evidence->back().value < bestEvidence.value) {
+      bestConfig = configuration;
+      bestEvidence = evidence->back();
+    }
+  }
+  if (bestConfig == Configuration{}) {
+    utils::ExceptionHandler::exception(
+        "AutoTuner::getBestKnownConfiguration(): There is no evidence for any configuration in the search space!");
+  }
+  return {bestConfig, bestEvidence};
+}
+
+Configuration AutoTuner::selectExplorationCandidate() const {
+  const auto [bestConfig, bestEvidence] = getBestKnownConfiguration();
+  const auto totalNumEvidence = std::transform_reduce(
+      _searchSpace.begin(), _searchSpace.end(), size_t{0}, std::plus(), [&](const auto &configuration) {
+        const auto *evidence = _evidenceCollection.getEvidence(configuration);
+        return evidence == nullptr ? size_t{0} : evidence->size();
+      });
+
+  Configuration candidate{bestConfig};
+  double candidateScore = -std::numeric_limits<double>::infinity();
+  for (const auto &configuration : _searchSpace) {
+    if (configuration == bestConfig or _inapplicableConfigurations.count(configuration) != 0) {
+      continue;
+    }
+    const auto *evidence = _evidenceCollection.getEvidence(configuration);
+    if (evidence == nullptr or evidence->empty()) {
+      return configuration;
+    }
+    const auto exploitation =
+        static_cast<double>(bestEvidence.value) / static_cast<double>(std::max(evidence->back().value, 1l));
+    const auto exploration =
+        std::sqrt(2. * std::log(static_cast<double>(totalNumEvidence)) / static_cast<double>(evidence->size()));
+    if (exploitation + exploration > candidateScore) {
+      candidate = configuration;
+      candidateScore = exploitation + exploration;
+    }
   }
+  return candidate;
+}
+
+void AutoTuner::endExploration() {
+  const auto [bestConfig, bestEvidence] = getBestKnownConfiguration();
+  AutoPasLog(DEBUG, "Exploration finished. Continuing with {}", bestConfig.toShortString());
+  _configQueue = {bestConfig};
+  _isExploring = false;
+  _isTuning = false;
+  // Fill up sample buffer to indicate we are not collecting samples anymore.
+  _samplesRebuildingNeighborLists.resize(_maxSamples);
+  _iterationBaseline = 0;
+  _iterationsSinceExploration = 0;
+  _nonTuningSamples.clear();
+  _nonTuningReferenceValue.reset();
 }
 
 void AutoTuner::bumpIterationCounters(bool needToWait) {
@@ -299,12 +691,24 @@ void AutoTuner::bumpIterationCounters(bool needToWait) {
   if (not(needToWait or inTuningPhase() or _iterationBaseline < _tuningInterval)) {
     _iterationBaseline = 0;
   }
-  ++_iterationBaseline;
+  // An iteration that only took speculative samples is repeated in the rebuild rhythm of the tuning phase.
+  if (_iterationWithoutSample) {
+    _iterationWithoutSample = false;
+  } else {
+    ++_iterationBaseline;
+  }
   ++_iteration;
   AutoPasLog(DEBUG, "Iteration: {}", _iteration);
   _endOfTuningPhase = false;
 
-  if (_iteration % _tuningInterval == 0) {
+  // Without drift since the last tuning phase, a regular tuning phase would only confirm the current optimum.
+  _tuningPhasePostponed = _retuneOnDrift and _iteration % _tuningInterval == 0 and not _driftDetected and
+                          not _isTuning and not _evidenceCollection.empty();
+  if (_tuningPhasePostponed) {
+    AutoPasLog(DEBUG, "No drift detected. Postponing the tuning phase.");
+  }
+
+  if (_iteration % _tuningInterval == 0 and not _tuningPhasePostponed) {
     ++_tuningPhase;
 
     if (_isTuning) {
@@ -312,19 +716,43 @@ void AutoTuner::bumpIterationCounters(bool needToWait) {
                  _tuningInterval);
     }
   }
+
+  if (not inTuningPhase() and not searchSpaceIsTrivial()) {
+    if (_driftDetected) {
+      ++_tuningPhase;
+      forceRetune();
+    } else if (tunesContinuously() and ++_iterationsSinceExploration >= _explorationInterval) {
+      _explorationPending = true;
+      // The first iteration of the exploration step rebuilds the neighbor lists.
+      _iterationBaseline = 0;
+    }
+  }
 }
 
 bool AutoTuner::willRebuildNeighborLists() const {
   // What is the rebuild rhythm?
-  const auto iterationsPerRebuild = this->inTuningPhase() ? _maxSamples : _rebuildFrequency;
-  // _iterationBaseLine + 1 since we want to look ahead to the next iteration
-  const auto iterationBaselineNextStep = _forceRetune ? _iterationBaseline : _iterationBaseline + 1;
+  const auto iterationsPerRebuild = this->inTuningPhase() ? _maxSamples : getRebuildFrequency(getCurrentConfig());
+  // _iterationBaseLine + 1 since we want to look ahead to the next iteration. An iteration that only took speculative
+  // samples is repeated, including its rebuild, so the baseline is not advanced then.
+  const auto iterationBaselineNextStep =
+      (_forceRetune or _explorationPending or _iterationWithoutSample) ? _iterationBaseline : _iterationBaseline + 1;
   return (iterationBaselineNextStep % iterationsPerRebuild) == 0;
 }
 
+bool AutoTuner::tuningMetricUsesEnergy() const {
+  return _tuningMetric == TuningMetricOption::energy or _tuningMetric == TuningMetricOption::energyPerFLOP or
+         _tuningMetric == TuningMetricOption::energyDelayProduct or
+         _tuningMetric == TuningMetricOption::energyBoundedSlowdown;
+}
+
 bool AutoTuner::initEnergy() {
   // Try to initialize the raplMeter
-  return _raplMeter.init(_tuningMetric == TuningMetricOption::energy || _tuningMetric == TuningMetricOption::energyPerFLOP || _tuningMetric == TuningMetricOption::energyDelayProduct);
+  return _raplMeter.init(tuningMetricUsesEnergy());
+}
+
+bool AutoTuner::initFrequency() {
+  // Reading the frequency of every CPU costs time in every iteration, so only do it if it affects the tuning.
+  return _energyMeasurementPossible and tuningMetricUsesEnergy() and _frequencyMeter.init(false);
 }
 
 bool AutoTuner::resetEnergy() {
@@ -338,28 +766,71 @@ bool AutoTuner::resetEnergy() {
        */
       AutoPasLog(WARN, "Energy Measurement no longer possible:\n\t{}", e.what());
       _energyMeasurementPossible = false;
-      if (_tuningMetric == TuningMetricOption::energy || _tuningMetric == TuningMetricOption::energyPerFLOP || _tuningMetric == TuningMetricOption::energyDelayProduct) {
+      if (tuningMetricUsesEnergy()) {
         utils::ExceptionHandler::exception(e);
       }
     }
   }
+  if (_frequencyMeasurementPossible) {
+    _frequencyMeter.reset();
+  }
   return _energyMeasurementPossible;
 }
 
-std::tuple<double, double, double, long> AutoTuner::sampleEnergy() {
+std::tuple<double, double, double, long, long, double, long> AutoTuner::sampleEnergy() {
   if (_energyMeasurementPossible) {
     try {
       _raplMeter.sample();
     } catch (const utils::ExceptionHandler::AutoPasException &e) {
       AutoPasLog(WARN, "Energy Measurement no longer possible:\n\t{}", e.what());
       _energyMeasurementPossible = false;
-      if (_tuningMetric == TuningMetricOption::energy || _tuningMetric == TuningMetricOption::energyPerFLOP || _tuningMetric == TuningMetricOption::energyDelayProduct) {
+      if (tuningMetricUsesEnergy()) {
         utils::ExceptionHandler::exception(e);
       }
     }
   }
-  return {_raplMeter.get_psys_energy(), _raplMeter.get_pkg_energy(), _raplMeter.get_ram_energy(),
-          _raplMeter.get_total_energy()};
+  const auto energyTotal = _raplMeter.get_total_energy();
+  auto energyTotalNormalized = energyTotal;
+  if (_frequencyMeasurementPossible) {
+    _frequencyMeter.sample();
+    const auto meanFrequency = _frequencyMeter.get_mean_frequency();
+    if (meanFrequency > 0.) {
+      energyTotalNormalized = static_cast<long>(static_cast<double>(energyTotal) *
+                                                _frequencyMeter.get_reference_frequency() / meanFrequency);
+    }
+  }
+  return {_raplMeter.get_psys_energy(),
+          _raplMeter.get_pkg_energy(),
+          _raplMeter.get_ram_energy(),
+          energyTotal,
+          energyTotalNormalized,
+          _frequencyMeter.get_mean_frequency(),
+          _frequencyMeter.get_throttle_events()};
+}
+
+bool AutoTuner::initPerfCounters() {
+  std::vector<utils::PerfCounterMeter::Event> requiredEvents{};
+  if (_tuningMetric == TuningMetricOption::cycles) {
+    requiredEvents.push_back(utils::PerfCounterMeter::cycles);
+  } else if (_tuningMetric == TuningMetricOption::llcMisses) {
+    requiredEvents.push_back(utils::PerfCounterMeter::llcMisses);
+  }
+  return _perfCounterMeter.init(requiredEvents);
+}
+
+bool AutoTuner::resetPerfCounters() {
+  if (_perfCounterMeasurementPossible) {
+    _perfCounterMeter.reset();
+  }
+  return _perfCounterMeasurementPossible;
+}
+
+std::tuple<long, long, long, long> AutoTuner::samplePerfCounters() {
+  if (_perfCounterMeasurementPossible) {
+    _perfCounterMeter.sample();
+  }
+  return {_perfCounterMeter.get_instructions(), _perfCounterMeter.get_cycles(), _perfCounterMeter.get_l1_misses(),
+          _perfCounterMeter.get_llc_misses()};
 }
 
 size_t AutoTuner::getCurrentNumSamples() const {
@@ -367,23 +838,69 @@ size_t AutoTuner::getCurrentNumSamples() const {
 }
 
 long AutoTuner::estimateRuntimeFromSamples() const {
+  return estimateFromSamples(_samplesRebuildingNeighborLists, _samplesNotRebuildingNeighborLists);
+}
+
+long AutoTuner::estimateFromSamples(const std::vector<long> &samplesRebuildingNeighborLists,
+                                    const std::vector<long> &samplesNotRebuildingNeighborLists) const {
   // reduce samples for rebuild and non-rebuild iterations with the given selector strategy
   const auto reducedValueBuilding =
-      autopas::OptimumSelector::optimumValue(_samplesRebuildingNeighborLists, _selectorStrategy);
+      autopas::OptimumSelector::optimumValue(samplesRebuildingNeighborLists, _selectorStrategy);
   // if there is no data for the non rebuild iterations we have to assume them taking the same time as rebuilding ones
   // this might neither be a good estimate nor fair but the best we can do
   const auto reducedValueNotBuilding =
-      _samplesNotRebuildingNeighborLists.empty()
+      samplesNotRebuildingNeighborLists.empty()
           ? reducedValueBuilding
-          : autopas::OptimumSelector::optimumValue(_samplesNotRebuildingNeighborLists, _selectorStrategy);
+          : autopas::OptimumSelector::optimumValue(samplesNotRebuildingNeighborLists, _selectorStrategy);
 
   // Calculate weighted average as if there was exactly one sample for each iteration in the rebuild interval.
-  return (reducedValueBuilding + (_rebuildFrequency - 1) * reducedValueNotBuilding) / _rebuildFrequency;
+  // The interval is the one of the sampled configuration, so configurations with different rebuild frequencies are
+  // compared fairly.
+  const auto rebuildFrequency = static_cast<long>(getRebuildFrequency(getCurrentConfig()));
+  return (reducedValueBuilding + (rebuildFrequency - 1) * reducedValueNotBuilding) / rebuildFrequency;
+}
+
+std::tuple<double, size_t> AutoTuner::estimateVarianceFromSamples() const {
+  // The estimate is a weighted sum of the reduced rebuild and non-rebuild samples (see estimateFromSamples()). Each
+  // reduced value is treated as a mean, so its variance is the sample variance divided by the number of samples.
+  const auto rebuildFrequency = static_cast<double>(getRebuildFrequency(getCurrentConfig()));
+  double variance{0.};
+  size_t numSamples{0};
+  for (const auto &[samples, weight] : {std::make_pair(&_samplesRebuildingNeighborLists, 1. / rebuildFrequency),
+                                        std::make_pair(&_samplesNotRebuildingNeighborLists,
+                                                       (rebuildFrequency - 1.) / rebuildFrequency)}) {
+    if (samples->size() < 2 or weight == 0.) {
+      continue;
+    }
+    const auto n = static_cast<double>(samples->size());
+    const auto mean = std::accumulate(samples->begin(), samples->end(), 0.) / n;
+    const auto sumOfSquares = std::accumulate(samples->begin(), samples->end(), 0., [&](double sum, long sample) {
+      return sum + (static_cast<double>(sample) - mean) * (static_cast<double>(sample) - mean);
+    });
+    variance += weight * weight * sumOfSquares / (n - 1.) / n;
+    numSamples += samples->size();
+  }
+  return {variance, numSamples};
+}
+
+double AutoTuner::confidenceHalfWidth(double variance, size_t numSamples) {
+  if (numSamples < 2) {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+  // Two-sided 95% quantiles of Student's t-distribution for 1 to 10 degrees of freedom. Beyond that, 2 is close enough.
+  constexpr std::array<double, 10> tQuantiles{12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228};
+  const auto degreesOfFreedom = numSamples - 1;
+  const auto tQuantile = degreesOfFreedom <= tQuantiles.size() ? tQuantiles[degreesOfFreedom - 1] : 2.;
+  return tQuantile * std::sqrt(variance);
+}
+
+unsigned int AutoTuner::getRebuildFrequency(const Configuration &configuration) const {
+  return configuration.rebuildFrequency == 0 ? _rebuildFrequency : configuration.rebuildFrequency;
 }
 
 bool AutoTuner::prepareIteration() {
   // Flag if this is the first iteration in a new tuning phase
-  const bool startOfTuningPhase = _iteration % _tuningInterval == 0 and not _isTuning;
+  const bool startOfTuningPhase = _iteration % _tuningInterval == 0 and not _isTuning and not _tuningPhasePostponed;
 
   // first tuning iteration -> reset everything
   if (startOfTuningPhase) {
@@ -442,10 +959,14 @@ const TuningMetricOption &AutoTuner::getTuningMetric() const { return _tuningMet
 bool AutoTuner::inTuningPhase() const {
   // If _iteration % _tuningInterval == 0 we are in the first tuning iteration but tuneConfiguration has not
   // been called yet.
-  return (_iteration % _tuningInterval == 0 or _isTuning or _forceRetune) and not searchSpaceIsTrivial();
+  return ((_iteration % _tuningInterval == 0 and not _tuningPhasePostponed) or _isTuning or _forceRetune or
+          _explorationPending) and
+         not searchSpaceIsTrivial();
 }
 
 const EvidenceCollection &AutoTuner::getEvidenceCollection() const { return _evidenceCollection; }
 
 bool AutoTuner::canMeasureEnergy() const { return _energyMeasurementPossible; }
+
+bool AutoTuner::canMeasurePerfCounters() const { return _perfCounterMeasurementPossible; }
 }  // namespace autopas
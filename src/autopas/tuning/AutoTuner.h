@@ -7,16 +7,23 @@
 #pragma once
 
 #include <cstddef>
+#include <limits>
+#include <map>
 #include <memory>
+#include <optional>
 #include <set>
 #include <tuple>
+#include <utility>
 
+#include "autopas/options/ContainerOption.h"
 #include "autopas/options/TuningMetricOption.h"
 #include "autopas/tuning/Configuration.h"
 #include "autopas/tuning/searchSpace/EvidenceCollection.h"
 #include "autopas/tuning/tuningStrategy/LiveInfo.h"
 #include "autopas/tuning/tuningStrategy/TuningStrategyInterface.h"
 #include "autopas/tuning/utils/AutoTunerInfo.h"
+#include "autopas/utils/CpuFrequencyMeter.h"
+#include "autopas/utils/PerfCounterMeter.h"
 #include "autopas/utils/RaplMeter.h"
 #include "autopas/utils/Timer.h"
 #include "autopas/utils/logging/TuningDataLogger.h"
@@ -37,6 +44,13 @@ namespace autopas {
  * Configuration to test next and b) which configuration is the best in this tuning phase.
  * If it should not look for a new optimum it is not in a tuning phase.
  *
+ * With continuous tuning (see AutoTunerInfo::explorationInterval), full tuning phases are replaced after the first one
+ * by short exploration steps, which sample a single configuration, and by drift detection on the selected
+ * configuration, which starts a new full tuning phase when its runtime changes substantially.
+ *
+ * With retuning on drift (see AutoTunerInfo::retuneOnDrift), the same runtime drift detection and a drift detection on
+ * the particle distribution start new tuning phases immediately, while regular tuning phases are postponed as long as
+ * nothing drifted.
  */
 class AutoTuner {
  public:
@@ -141,6 +155,22 @@ class AutoTuner {
    */
   [[nodiscard]] std::tuple<Configuration, bool> rejectConfig(const Configuration &rejectedConfig, bool indefinitely);
 
+  /**
+   * Set the configurations that are known to be not applicable in the current domain.
+   * They are left out whenever the queue is refilled at the start of a tuning phase or an exploration step, so no
+   * iteration is spent on rejecting them. They stay in the search space because they might become applicable after
+   * the domain changes. If no other configuration is left, the queue is filled with them anyway.
+   *
+   * @param inapplicableConfigurations
+   */
+  void setInapplicableConfigurations(SearchSpaceType inapplicableConfigurations);
+
+  /**
+   * Getter for the search space.
+   * @return
+   */
+  [[nodiscard]] const SearchSpaceType &getSearchSpace() const;
+
   /**
    * Indicator function whether the search space consists of exactly one configuration.
    * @return
@@ -167,16 +197,46 @@ class AutoTuner {
   bool initEnergy();
 
   /**
-   * Reset the rapl meter to prepare for a new measurement.
+   * Initialize the CPU frequency meter. Frequencies are only measured if the tuning metric is based on energy.
+   * @return True if the CPU frequency can be measured alongside the energy.
+   */
+  bool initFrequency();
+
+  /**
+   * Reset the rapl meter and the CPU frequency meter to prepare for a new measurement.
    * @return True if energy measurements are possible on this system.
    */
   bool resetEnergy();
 
   /**
    * Take an energy measurement.
-   * @return Tuple<PsysEnergy, PkgEnergy, RamEnergy, TotalEnergy>
+   *
+   * The total energy is returned as measured. If the CPU frequency is measured, it is additionally normalized to the
+   * reference frequency by multiplying it with the ratio of reference frequency and mean frequency. This way,
+   * configurations that were sampled while the CPU ran in a higher turbo state are not penalized for it when tuning for
+   * energyBoundedSlowdown. Without a frequency measurement, the normalized energy equals the total energy.
+   *
+   * @return Tuple<PsysEnergy, PkgEnergy, RamEnergy, TotalEnergy, NormalizedTotalEnergy, MeanFrequency, ThrottleEvents>
+   */
+  std::tuple<double, double, double, long, long, double, long> sampleEnergy();
+
+  /**
+   * Initialize the hardware counters.
+   * @return True if hardware counter measurements are possible on this system.
+   */
+  bool initPerfCounters();
+
+  /**
+   * Reset the hardware counters to prepare for a new measurement.
+   * @return True if hardware counter measurements are possible on this system.
    */
-  std::tuple<double, double, double, long> sampleEnergy();
+  bool resetPerfCounters();
+
+  /**
+   * Take a hardware counter measurement.
+   * @return Tuple<Instructions, Cycles, L1CacheMisses, LLCMisses>
+   */
+  std::tuple<long, long, long, long> samplePerfCounters();
 
   /**
    * Save the runtime of a given traversal.
@@ -185,10 +245,102 @@ class AutoTuner {
    * on to the tuning strategy. This function expects that samples of the same configuration are taken consecutively.
    * The sample argument is a long because std::chrono::duration::count returns a long.
    *
+   * If the samples collected so far already exceed the best evidence of this tuning phase by more than the early
+   * stopping factor, the remaining samples are skipped and the evidence is derived from what was collected.
+   *
+   * @param sample
+   * @param neighborListRebuilt If the neighbor list as been rebuilt during the given time.
+   * @param timeSample Runtime of the sampled iteration. Only needed for the tuning metric energyBoundedSlowdown.
+   */
+  void addMeasurement(long sample, bool neighborListRebuilt, long timeSample = 0);
+
+  /**
+   * Get the configuration that can be sampled concurrently to the current one.
+   *
+   * This is the next configuration in the queue that has no speculative sample yet. Only one speculative sample is
+   * taken per current configuration, before the first regular sample of it. Outside of tuning phases, during
+   * exploration steps, and without a finite early stopping factor, which is needed to use the samples, there is none.
+   * @return Configuration or nullopt if there is nothing to sample ahead.
+   */
+  [[nodiscard]] std::optional<Configuration> getSpeculativeConfig() const;
+
+  /**
+   * Save a sample of a configuration that is not the current one, together with a sample of the current configuration
+   * that was measured concurrently under the same conditions.
+   *
+   * Both samples are taken with only a part of the threads, so they are not used as evidence. Instead, their ratio and
+   * the evidence of the current configuration estimate the value of the speculative configuration. When it becomes the
+   * current configuration and the estimate exceeds the early stopping factor times the best evidence of the tuning
+   * phase, it is skipped without being sampled. A new tuning phase discards the estimates.
+   *
+   * The iteration of the concurrent samples does not count as a regular sample of the current configuration, so it
+   * does not advance the neighbor list rebuild rhythm of the tuning phase and willRebuildNeighborLists() repeats its
+   * rebuild in the next iteration.
+   *
+   * @param configuration The speculative configuration.
+   * @param sample Sample of the speculative configuration.
+   * @param referenceSample Sample of the current configuration.
+   */
+  void addSpeculativeMeasurement(const Configuration &configuration, long sample, long referenceSample);
+
+  /**
+   * Save a measurement of an iteration outside of tuning.
+   *
+   * With continuous tuning or retuning on drift, these measurements are condensed like samples and compared to the
+   * first condensed value after the last selection of the optimum. If they differ by more than the drift threshold, a
+   * new tuning phase is started after the current iteration. Otherwise, this function does nothing.
+   *
    * @param sample
    * @param neighborListRebuilt If the neighbor list as been rebuilt during the given time.
    */
-  void addMeasurement(long sample, bool neighborListRebuilt);
+  void addNonTuningMeasurement(long sample, bool neighborListRebuilt);
+
+  /**
+   * Indicates whether the tuner uses continuous tuning instead of regular tuning phases.
+   * @return
+   */
+  [[nodiscard]] bool tunesContinuously() const;
+
+  /**
+   * Pass statistics of the particle distribution, which are gathered outside of tuning, to the drift detection.
+   *
+   * The first statistics after a tuning phase serve as reference. If homogeneity or maximum density change by more than
+   * the scenario drift threshold relative to the reference maximum density, a new tuning phase is started after the
+   * current iteration. Without retuning on drift, this function does nothing.
+   *
+   * @param homogeneity
+   * @param maxDensity
+   */
+  void addScenarioStatistics(double homogeneity, double maxDensity);
+
+  /**
+   * Indicates whether the tuner retunes when the runtime or the particle distribution drifts.
+   * @return
+   */
+  [[nodiscard]] bool retunesOnDrift() const;
+
+  /**
+   * Save the measured cost of switching from one container to another.
+   *
+   * The cost of a container pair is the time of the most recent switch.
+   *
+   * @param from Container before the switch.
+   * @param to Container after the switch.
+   * @param time Time it took to convert the particles and rebuild the neighbor lists in the new container.
+   */
+  void addContainerSwitchCost(const ContainerOption &from, const ContainerOption &to, long time);
+
+  /**
+   * Set the container that is currently in use. Switch costs are estimated for switches away from it.
+   * @param container
+   */
+  void setActiveContainer(const ContainerOption &container);
+
+  /**
+   * Getter for the measured container switch costs.
+   * @return Map of (from, to) -> time of the most recent switch.
+   */
+  const std::map<std::pair<ContainerOption, ContainerOption>, long> &getContainerSwitchCosts() const;
 
   /**
    * Adds measurements of homogeneity and maximal density to the vector of measurements.
@@ -228,12 +380,34 @@ class AutoTuner {
    */
   bool canMeasureEnergy() const;
 
+  /**
+   * Returns whether the AutoTuner can take hardware counter measurements.
+   * @return
+   */
+  bool canMeasurePerfCounters() const;
+
  private:
   /**
    * Measures consumed energy for tuning
    */
   utils::RaplMeter _raplMeter;
 
+  /**
+   * Measures hardware counters for tuning and logging
+   */
+  utils::PerfCounterMeter _perfCounterMeter;
+
+  /**
+   * Measures the CPU frequency to normalize energy measurements.
+   */
+  utils::CpuFrequencyMeter _frequencyMeter;
+
+  /**
+   * Checks if the tuning metric is based on energy measurements.
+   * @return
+   */
+  [[nodiscard]] bool tuningMetricUsesEnergy() const;
+
   /**
    * Total number of collected samples. This is the sum of the sizes of all sample vectors.
    * @return Sum of sizes of sample vectors.
@@ -248,6 +422,38 @@ class AutoTuner {
    */
   [[nodiscard]] long estimateRuntimeFromSamples() const;
 
+  /**
+   * Estimate the value of one iteration from the given samples of the current configuration.
+   * See estimateRuntimeFromSamples().
+   * @param samplesRebuildingNeighborLists
+   * @param samplesNotRebuildingNeighborLists
+   * @return
+   */
+  [[nodiscard]] long estimateFromSamples(const std::vector<long> &samplesRebuildingNeighborLists,
+                                         const std::vector<long> &samplesNotRebuildingNeighborLists) const;
+
+  /**
+   * Estimate the variance of estimateRuntimeFromSamples() from the spread of the current samples.
+   * Only sample vectors with at least two entries contribute.
+   * @return Tuple of the variance and the number of samples it is based on.
+   */
+  [[nodiscard]] std::tuple<double, size_t> estimateVarianceFromSamples() const;
+
+  /**
+   * Half width of the 95% confidence interval of a value with the given variance.
+   * @param variance
+   * @param numSamples Number of samples the variance was estimated from.
+   * @return Half width or NaN if the variance is based on less than two samples.
+   */
+  [[nodiscard]] static double confidenceHalfWidth(double variance, size_t numSamples);
+
+  /**
+   * Rebuild frequency that is used with the given configuration.
+   * @param configuration
+   * @return The rebuild frequency of the configuration or, if it does not specify one, the default rebuild frequency.
+   */
+  [[nodiscard]] unsigned int getRebuildFrequency(const Configuration &configuration) const;
+
   /**
    * Tune available algorithm configurations.
    *
@@ -259,6 +465,49 @@ class AutoTuner {
    */
   bool tuneConfiguration();
 
+  /**
+   * Determine the configuration with the best latest evidence over the whole search space.
+   * @return Tuple<Configuration, its latest evidence>
+   */
+  [[nodiscard]] std::tuple<Configuration, Evidence> getBestKnownConfiguration() const;
+
+  /**
+   * Determine the optimum of the current tuning phase.
+   *
+   * Without switch costs, this is the configuration with the best evidence. With switch costs, it is the configuration
+   * with the lowest expected time for the iterations until the next tuning phase plus the cost of switching from the
+   * active container to its container.
+   *
+   * @return Tuple<Configuration, its evidence of the current tuning phase>
+   */
+  [[nodiscard]] std::tuple<Configuration, Evidence> selectOptimalConfiguration() const;
+
+  /**
+   * Estimate the cost of switching from the active container to the given one.
+   *
+   * If this switch was never measured, the mean of all switches into the container is used. If there is none either,
+   * the switch is assumed to be free.
+   *
+   * @param to
+   * @return Estimated time of the switch.
+   */
+  [[nodiscard]] long estimateContainerSwitchCost(const ContainerOption &to) const;
+
+  /**
+   * Pick the configuration to sample in an exploration step of continuous tuning.
+   *
+   * Configurations without evidence are picked first. Otherwise, the configuration maximizing the upper confidence
+   * bound of best value / latest value + sqrt(2 ln(total evidence) / evidence of configuration) is picked.
+   *
+   * @return
+   */
+  [[nodiscard]] Configuration selectExplorationCandidate() const;
+
+  /**
+   * Switch back to the best known configuration at the end of an exploration step.
+   */
+  void endExploration();
+
   /**
    * Strategy how to reduce the sampled values to one value.
    */
@@ -307,7 +556,18 @@ class AutoTuner {
   bool _energyMeasurementPossible;
 
   /**
-   * The rebuild frequency this instance of AutoPas uses.
+   * Is the CPU frequency measured alongside the energy.
+   */
+  bool _frequencyMeasurementPossible;
+
+  /**
+   * Is hardware counter measurement possible.
+   * Checked in the constructor. Required if the tuning metric is based on hardware counters.
+   */
+  bool _perfCounterMeasurementPossible;
+
+  /**
+   * The rebuild frequency this instance of AutoPas uses for configurations that do not specify their own.
    */
   unsigned int _rebuildFrequency;
 
@@ -316,6 +576,64 @@ class AutoTuner {
    */
   size_t _maxSamples;
 
+  /**
+   * If the estimate from the first samples of a configuration exceeds the best evidence of the current tuning phase by
+   * this factor, the remaining samples of the configuration are skipped.
+   */
+  double _earlyStoppingFactor;
+
+  /**
+   * Maximal number of samples per configuration for adaptive sampling. Adaptive sampling is disabled if this is not
+   * larger than _maxSamples.
+   */
+  size_t _maxAdaptiveSamples;
+
+  /**
+   * Number of samples that are collected for the current configuration. This is _maxSamples unless adaptive sampling
+   * decided to take more.
+   */
+  size_t _currentMaxSamples;
+
+  /**
+   * Number of iterations between two exploration steps. Zero if continuous tuning is disabled.
+   */
+  size_t _explorationInterval;
+
+  /**
+   * Relative change of the runtime of the selected configuration that triggers a new tuning phase in continuous tuning.
+   */
+  double _driftThreshold;
+
+  /**
+   * Whether tuning phases are started by drift instead of only by the tuning interval.
+   */
+  bool _retuneOnDrift;
+
+  /**
+   * Relative change of homogeneity or maximum density that counts as drift of the particle distribution.
+   */
+  double _scenarioDriftThreshold;
+
+  /**
+   * Whether the selection of the optimum takes container switch costs into account.
+   */
+  bool _considerSwitchCosts;
+
+  /**
+   * Relative slowdown compared to the fastest configuration that the tuning metric energyBoundedSlowdown accepts.
+   */
+  double _maxSlowdown;
+
+  /**
+   * Most recently measured time of switching between two containers. (from, to) -> time
+   */
+  std::map<std::pair<ContainerOption, ContainerOption>, long> _containerSwitchCosts{};
+
+  /**
+   * Container that is currently in use. Empty if it was not reported yet.
+   */
+  std::optional<ContainerOption> _activeContainer{};
+
   /**
    * Flag indicating if any tuning strategy needs the smoothed homogeneity and max density collected.
    */
@@ -350,16 +668,65 @@ class AutoTuner {
    */
   std::vector<long> _samplesRebuildingNeighborLists{};
 
+  /**
+   * Runtimes of the samples of the current configuration in iterations where the neighbor lists are not rebuilt.
+   * Only collected for the tuning metric energyBoundedSlowdown.
+   */
+  std::vector<long> _timeSamplesNotRebuildingNeighborLists{};
+
+  /**
+   * Runtimes of the samples of the current configuration in iterations where the neighbor lists have been rebuilt.
+   * Only collected for the tuning metric energyBoundedSlowdown.
+   */
+  std::vector<long> _timeSamplesRebuildingNeighborLists{};
+
+  /**
+   * Runtime evidence of all configurations. Only collected for the tuning metric energyBoundedSlowdown, where the
+   * regular evidence holds the energy consumption.
+   */
+  EvidenceCollection _timeEvidenceCollection{};
+
   /**
    * Database of all evidence collected so far.
    */
   EvidenceCollection _evidenceCollection{};
 
+  /**
+   * Best (smoothed) evidence value that was collected in the current tuning phase. Reference for early stopping.
+   */
+  long _bestEvidenceValueInTuningPhase{std::numeric_limits<long>::max()};
+
+  /**
+   * Half width of the confidence interval of the best evidence in the current tuning phase. NaN if unknown.
+   */
+  double _bestEvidenceHalfWidthInTuningPhase{std::numeric_limits<double>::quiet_NaN()};
+
   /**
    * The search space for this tuner.
    */
   SearchSpaceType _searchSpace;
 
+  /**
+   * Configurations of the search space that are not applicable in the current domain.
+   */
+  SearchSpaceType _inapplicableConfigurations{};
+
+  /**
+   * Estimates of configurations that were sampled concurrently to another one before they became the current
+   * configuration. Each estimate is stored as the configuration it was sampled with and the ratio of both samples.
+   */
+  std::map<Configuration, std::pair<Configuration, double>> _speculativeEstimates{};
+
+  /**
+   * Indicates that the current configuration was already sampled concurrently to a speculative configuration.
+   */
+  bool _speculativeReferenceSampled{false};
+
+  /**
+   * Indicates that the current iteration only took speculative samples, so the iteration baseline is not advanced.
+   */
+  bool _iterationWithoutSample{false};
+
   /**
    * Sorted queue of configurations that should be looked at in this tuning phase.
    * Initially this is the full search space. Tuning strategies then can filter and resort this.
@@ -407,5 +774,47 @@ class AutoTuner {
    * a tuning phase
    */
   size_t _iterationBaseline{0};
+
+  /**
+   * Is set to true in bumpIterationCounters() to signal an exploration step should start. Is set back to false in
+   * tuneConfiguration().
+   */
+  bool _explorationPending{false};
+
+  /**
+   * Is set to true while an exploration step of continuous tuning is running.
+   */
+  bool _isExploring{false};
+
+  /**
+   * Number of non-tuning iterations since the last exploration step or tuning phase.
+   */
+  size_t _iterationsSinceExploration{0};
+
+  /**
+   * Is set to true if the runtime of the selected configuration drifted. Is handled in bumpIterationCounters().
+   */
+  bool _driftDetected{false};
+
+  /**
+   * Samples of the selected configuration outside of tuning. Only used with continuous tuning.
+   */
+  std::vector<long> _nonTuningSamples{};
+
+  /**
+   * First condensed value of _nonTuningSamples after the optimum was selected. Reference for the drift detection.
+   */
+  std::optional<long> _nonTuningReferenceValue{};
+
+  /**
+   * First homogeneity and maximum density passed to addScenarioStatistics() after the last tuning phase.
+   */
+  std::optional<std::pair<double, double>> _scenarioReference{};
+
+  /**
+   * Is set to true in bumpIterationCounters() if a regular tuning phase would start in this iteration but is skipped
+   * because retuning on drift found no drift.
+   */
+  bool _tuningPhasePostponed{false};
 };
 }  // namespace autopas
@@ -12,7 +12,11 @@ std::string autopas::Configuration::toString() const {
   return "{Interaction Type: " + interactionType.to_string() + " , Container: " + container.to_string() +
          " , CellSizeFactor: " + std::to_string(cellSizeFactor) + " , Traversal: " + traversal.to_string() +
          " , Load Estimator: " + loadEstimator.to_string() + " , Data Layout: " + dataLayout.to_string() +
-         " , Newton 3: " + newton3.to_string() + "}";
+         " , Newton 3: " + newton3.to_string() +
+         // Optional options are only shown if they are tuned to keep the output of untuned runs unchanged.
+         (rebuildFrequency == 0 ? std::string{} : " , Rebuild Frequency: " + std::to_string(rebuildFrequency)) +
+         (threadCount == 0 ? std::string{} : " , Threads: " + std::to_string(threadCount)) +
+         (chunkSize == 0 ? std::string{} : " , Chunk Size: " + std::to_string(chunkSize)) + "}";
 }
 
 std::string autopas::Configuration::getCSVHeader() const { return getCSVRepresentation(true); }
@@ -89,6 +93,14 @@ bool autopas::Configuration::hasCompatibleValues() const {
     }
   }
 
+  // A chunk size only makes a difference for traversals that use it.
+  if (chunkSize != 0) {
+    const auto chunkSizeTraversals = compatibleTraversals::allTraversalsSupportingChunkSize();
+    if (chunkSizeTraversals.find(traversal) == chunkSizeTraversals.end()) {
+      return false;
+    }
+  }
+
   return true;
 }
 
@@ -98,7 +110,8 @@ std::ostream &autopas::operator<<(std::ostream &os, const autopas::Configuration
 
 bool autopas::Configuration::equalsDiscreteOptions(const autopas::Configuration &rhs) const {
   return container == rhs.container and traversal == rhs.traversal and loadEstimator == rhs.loadEstimator and
-         dataLayout == rhs.dataLayout and newton3 == rhs.newton3 and interactionType == rhs.interactionType;
+         dataLayout == rhs.dataLayout and newton3 == rhs.newton3 and interactionType == rhs.interactionType and
+         rebuildFrequency == rhs.rebuildFrequency and threadCount == rhs.threadCount and chunkSize == rhs.chunkSize;
 }
 
 bool autopas::Configuration::equalsContinuousOptions(const autopas::Configuration &rhs, double epsilon) const {
@@ -115,8 +128,9 @@ bool autopas::operator!=(const autopas::Configuration &lhs, const autopas::Confi
 
 bool autopas::operator<(const autopas::Configuration &lhs, const autopas::Configuration &rhs) {
   return std::tie(lhs.container, lhs.cellSizeFactor, lhs.traversal, lhs.loadEstimator, lhs.dataLayout, lhs.newton3,
-                  lhs.interactionType) < std::tie(rhs.container, rhs.cellSizeFactor, rhs.traversal, rhs.loadEstimator,
-                                                  rhs.dataLayout, rhs.newton3, rhs.interactionType);
+                  lhs.interactionType, lhs.rebuildFrequency, lhs.threadCount, lhs.chunkSize) <
+         std::tie(rhs.container, rhs.cellSizeFactor, rhs.traversal, rhs.loadEstimator, rhs.dataLayout, rhs.newton3,
+                  rhs.interactionType, rhs.rebuildFrequency, rhs.threadCount, rhs.chunkSize);
 }
 
 std::istream &autopas::operator>>(std::istream &in, autopas::Configuration &configuration) {
@@ -135,5 +149,24 @@ std::istream &autopas::operator>>(std::istream &in, autopas::Configuration &conf
   in >> configuration.dataLayout;
   in.ignore(max, ':');
   in >> configuration.newton3;
+  // The remaining options are optional and identified by their label. Parsing a value consumed either the closing
+  // bracket or the following space.
+  configuration.rebuildFrequency = 0;
+  configuration.threadCount = 0;
+  configuration.chunkSize = 0;
+  while (in.peek() == ',') {
+    std::string label;
+    std::getline(in, label, ':');
+    unsigned int value{0};
+    in >> value;
+    in.ignore(1);
+    if (label.find("Rebuild Frequency") != std::string::npos) {
+      configuration.rebuildFrequency = value;
+    } else if (label.find("Threads") != std::string::npos) {
+      configuration.threadCount = value;
+    } else if (label.find("Chunk Size") != std::string::npos) {
+      configuration.chunkSize = value;
+    }
+  }
   return in;
 }
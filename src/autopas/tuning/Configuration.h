@@ -32,26 +32,42 @@ class Configuration {
    * @param _newton3
    * @param _cellSizeFactor
    * @param _interactionType
+   * @param _rebuildFrequency
+   * @param _threadCount
+   * @param _chunkSize
    *
    * @note needs constexpr (hence inline) constructor to be a literal.
    */
   constexpr Configuration(ContainerOption _container, double _cellSizeFactor, TraversalOption _traversal,
                           LoadEstimatorOption _loadEstimator, DataLayoutOption _dataLayout, Newton3Option _newton3,
-                          InteractionTypeOption _interactionType)
+                          InteractionTypeOption _interactionType, unsigned int _rebuildFrequency = 0,
+                          unsigned int _threadCount = 0, unsigned int _chunkSize = 0)
       : container(_container),
         traversal(_traversal),
         loadEstimator(_loadEstimator),
         dataLayout(_dataLayout),
         newton3(_newton3),
         cellSizeFactor(_cellSizeFactor),
-        interactionType(_interactionType) {}
+        interactionType(_interactionType),
+        rebuildFrequency(_rebuildFrequency),
+        threadCount(_threadCount),
+        chunkSize(_chunkSize) {}
 
   /**
    * Constructor taking no arguments. Initializes all properties to an invalid choice or false.
    * @note needs constexpr (hence inline) constructor to be a literal.
    */
   constexpr Configuration()
-      : container(), traversal(), loadEstimator(), dataLayout(), newton3(), cellSizeFactor(-1.), interactionType() {}
+      : container(),
+        traversal(),
+        loadEstimator(),
+        dataLayout(),
+        newton3(),
+        cellSizeFactor(-1.),
+        interactionType(),
+        rebuildFrequency(0),
+        threadCount(0),
+        chunkSize(0) {}
 
   /**
    * Returns string representation in JSON style of the configuration object.
@@ -68,7 +84,10 @@ class Configuration {
     return "{" + interactionType.to_string(interactionType) + " , " + container.to_string(fixedLength) + " , " +
            std::to_string(cellSizeFactor) + " , " + traversal.to_string(fixedLength) + " , " +
            loadEstimator.to_string(fixedLength) + " , " + dataLayout.to_string(fixedLength) + " , " +
-           newton3.to_string(fixedLength) + "}";
+           newton3.to_string(fixedLength) +
+           (rebuildFrequency == 0 ? std::string{} : " , " + std::to_string(rebuildFrequency)) +
+           (threadCount == 0 ? std::string{} : " , " + std::to_string(threadCount) + " threads") +
+           (chunkSize == 0 ? std::string{} : " , chunk " + std::to_string(chunkSize)) + "}";
   }
 
   /**
@@ -140,6 +159,19 @@ class Configuration {
    * Interaction type of the configuration.
    */
   InteractionTypeOption interactionType;
+  /**
+   * Number of iterations between two neighbor list rebuilds. The Verlet skin scales with it, so that the skin per
+   * timestep stays the same. Zero means the rebuild frequency AutoPas was initialized with is used.
+   */
+  unsigned int rebuildFrequency;
+  /**
+   * Number of OpenMP threads used to compute the interactions. Zero means all available threads are used.
+   */
+  unsigned int threadCount;
+  /**
+   * Chunk size of the dynamically scheduled OpenMP loops of the traversal. Zero means the traversal's default is used.
+   */
+  unsigned int chunkSize;
 
  private:
   /**
@@ -187,7 +219,7 @@ bool operator!=(const Configuration &lhs, const Configuration &rhs);
  * sets.
  *
  * Configurations are compared member wise in the order: container, cellSizeFactor, traversal, loadEstimator,
- * dataLayout, newton3.
+ * dataLayout, newton3, interactionType, rebuildFrequency, threadCount, chunkSize.
  *
  * @param lhs
  * @param rhs
@@ -210,7 +242,10 @@ struct ConfigHash {
                            static_cast<std::size_t>(configuration.dataLayout) * 100 +
                            static_cast<std::size_t>(configuration.loadEstimator) * 1000 +
                            static_cast<std::size_t>(configuration.traversal) * 10000 +
-                           static_cast<std::size_t>(configuration.container) * 100000;
+                           static_cast<std::size_t>(configuration.container) * 100000 +
+                           static_cast<std::size_t>(configuration.rebuildFrequency) * 10000000 +
+                           static_cast<std::size_t>(configuration.threadCount) * 10000000000 +
+                           static_cast<std::size_t>(configuration.chunkSize) * 10000000000000;
     std::size_t doubleHash = std::hash<double>{}(configuration.cellSizeFactor);
 
     return enumHash ^ doubleHash;
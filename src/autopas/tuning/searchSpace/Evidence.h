@@ -26,6 +26,14 @@ class Evidence {
    * Value of the measurement (time, energy, ...).
    */
   long value;
+  /**
+   * Estimated variance of value. Only meaningful if numSamples is at least two.
+   */
+  double variance{0.};
+  /**
+   * Number of samples the variance was estimated from. Zero if the variance is unknown.
+   */
+  size_t numSamples{0};
 
   /**
    * Equality operator.
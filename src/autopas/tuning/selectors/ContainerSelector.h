@@ -6,7 +6,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <limits>
+#include <list>
+#include <memory>
 #include <vector>
 
 #include "autopas/containers/CellBasedParticleContainer.h"
@@ -22,8 +26,11 @@
 #include "autopas/containers/verletListsCellBased/verletListsCells/VerletListsCellsHelpers.h"
 #include "autopas/options/ContainerOption.h"
 #include "autopas/tuning/selectors/ContainerSelectorInfo.h"
-#include "autopas/utils/NumParticlesEstimator.h"
+#include "autopas/utils/ArrayMath.h"
 #include "autopas/utils/StringUtils.h"
+#include "autopas/utils/WrapOpenMP.h"
+#include "autopas/utils/inBox.h"
+#include "autopas/utils/logging/Logger.h"
 
 namespace autopas {
 
@@ -64,9 +71,42 @@ class ContainerSelector {
     _boxMin = boxMin;
     _boxMax = boxMax;
 
+    // Shadow containers were built for the old box.
+    clearShadowContainers();
     _currentContainer = std::move(generateContainer(_currentContainer->getContainerType(), _currentInfo));
   }
 
+  /**
+   * Set how many previously used containers are kept alive as shadows.
+   *
+   * When switching back to a shadow container, its outdated particles are deleted and all current particles are copied
+   * into it. This only saves allocating the cells and their particle storage; neighbor lists are rebuilt as after any
+   * switch. Shadows are evicted in least recently used order when there are too many of them or their memory, as
+   * estimated by ParticleContainerInterface::getMemoryEstimate(), exceeds the budget.
+   *
+   * @param maxNumShadowContainers Maximal number of shadow containers. Zero disables shadow containers.
+   * @param memoryBudget Maximal estimated memory in bytes that all shadow containers may occupy together.
+   */
+  void setShadowContainers(size_t maxNumShadowContainers, size_t memoryBudget) {
+    _maxNumShadowContainers = maxNumShadowContainers;
+    _shadowContainerMemoryBudget = memoryBudget;
+    evictShadowContainers();
+  }
+
+  /**
+   * Release all shadow containers.
+   */
+  void clearShadowContainers() {
+    _shadowContainers.clear();
+    _shadowContainerMemory = 0;
+  }
+
+  /**
+   * Getter for the number of currently kept shadow containers.
+   * @return
+   */
+  [[nodiscard]] size_t getNumShadowContainers() const { return _shadowContainers.size(); }
+
   /**
    * Getter for the optimal container. If no container is chosen yet the first allowed is selected.
    * @return Reference to the optimal container.
@@ -79,6 +119,37 @@ class ContainerSelector {
    */
   inline const autopas::ParticleContainerInterface<Particle> &getCurrentContainer() const;
 
+  /**
+   * Getter for the info the current container was created with.
+   * @return
+   */
+  [[nodiscard]] const ContainerSelectorInfo &getCurrentContainerInfo() const { return _currentInfo; }
+
+  /**
+   * Generates a container for a subdomain of the current container and fills it with copies of the particles in this
+   * region. Particles inside the subdomain become owned particles, particles within one interaction length around it
+   * become halo particles. The current container is not changed.
+   * @param containerChoice container to generate
+   * @param containerInfo additional parameter for the container
+   * @param subdomainMin Lower corner of the subdomain.
+   * @param subdomainMax Upper corner of the subdomain.
+   * @return Smartpointer to new container
+   */
+  std::unique_ptr<autopas::ParticleContainerInterface<Particle>> generateSubdomainContainer(
+      ContainerOption containerChoice, ContainerSelectorInfo containerInfo, const std::array<double, 3> &subdomainMin,
+      const std::array<double, 3> &subdomainMax) const;
+
+  /**
+   * Generates an empty container spanning the whole domain. The current container is not changed.
+   * @param containerChoice container to generate
+   * @param containerInfo additional parameter for the container
+   * @return Smartpointer to new container
+   */
+  std::unique_ptr<autopas::ParticleContainerInterface<Particle>> generateEmptyContainer(
+      ContainerOption containerChoice, const ContainerSelectorInfo &containerInfo) const {
+    return createEmptyContainer(containerChoice, containerInfo, _boxMin, _boxMax);
+  }
+
  private:
   /**
    * Container factory that also copies all particles to the new container
@@ -89,69 +160,149 @@ class ContainerSelector {
   std::unique_ptr<autopas::ParticleContainerInterface<Particle>> generateContainer(ContainerOption containerChoice,
                                                                                    ContainerSelectorInfo containerInfo);
 
+  /**
+   * Container factory that creates an empty container.
+   * @param containerChoice container to generate
+   * @param containerInfo additional parameter for the container
+   * @param boxMin Lower corner of the new container.
+   * @param boxMax Upper corner of the new container.
+   * @return Smartpointer to new container
+   */
+  std::unique_ptr<autopas::ParticleContainerInterface<Particle>> createEmptyContainer(
+      ContainerOption containerChoice, ContainerSelectorInfo containerInfo, const std::array<double, 3> &boxMin,
+      const std::array<double, 3> &boxMax) const;
+
+  /**
+   * Copy all particles of the current container to the given one.
+   * @param container
+   */
+  void copyParticlesFromCurrentContainer(autopas::ParticleContainerInterface<Particle> &container);
+
+  /**
+   * Remove the shadow container matching the given option and info from the shadows and empty it.
+   * @param containerChoice
+   * @param containerInfo
+   * @return The emptied container or nullptr if there is no matching shadow.
+   */
+  std::unique_ptr<autopas::ParticleContainerInterface<Particle>> takeShadowContainer(
+      ContainerOption containerChoice, const ContainerSelectorInfo &containerInfo);
+
+  /**
+   * Keep the given container as most recently used shadow container if shadows are enabled.
+   * The particles are only deleted when the shadow is used again.
+   * @param container
+   * @param containerInfo
+   */
+  void storeShadowContainer(std::unique_ptr<autopas::ParticleContainerInterface<Particle>> container,
+                            const ContainerSelectorInfo &containerInfo);
+
+  /**
+   * Evict the least recently used shadow containers until number and memory of the shadows are within their limits.
+   */
+  void evictShadowContainers();
+
+  /**
+   * A previously used container that is kept to speed up switching back to it.
+   */
+  struct ShadowContainer {
+    /**
+     * Info the container was created with.
+     */
+    ContainerSelectorInfo info;
+    /**
+     * The container itself.
+     */
+    std::unique_ptr<autopas::ParticleContainerInterface<Particle>> container;
+    /**
+     * Estimate of the memory in bytes the container occupies, as reported by the container when it became a shadow.
+     */
+    size_t memoryEstimate;
+  };
+
   std::array<double, 3> _boxMin, _boxMax;
   const double _cutoff;
   std::unique_ptr<autopas::ParticleContainerInterface<Particle>> _currentContainer;
   ContainerSelectorInfo _currentInfo;
+
+  /**
+   * Shadow containers ordered from most to least recently used.
+   */
+  std::list<ShadowContainer> _shadowContainers{};
+
+  /**
+   * Maximal number of shadow containers.
+   */
+  size_t _maxNumShadowContainers{0};
+
+  /**
+   * Maximal estimated memory in bytes of all shadow containers.
+   */
+  size_t _shadowContainerMemoryBudget{std::numeric_limits<size_t>::max()};
+
+  /**
+   * Sum of the memory estimates of all shadow containers.
+   */
+  size_t _shadowContainerMemory{0};
 };
 
 template <class Particle>
-std::unique_ptr<autopas::ParticleContainerInterface<Particle>> ContainerSelector<Particle>::generateContainer(
-    ContainerOption containerChoice, ContainerSelectorInfo containerInfo) {
+std::unique_ptr<autopas::ParticleContainerInterface<Particle>> ContainerSelector<Particle>::createEmptyContainer(
+    ContainerOption containerChoice, ContainerSelectorInfo containerInfo, const std::array<double, 3> &boxMin,
+    const std::array<double, 3> &boxMax) const {
   std::unique_ptr<autopas::ParticleContainerInterface<Particle>> container;
   switch (containerChoice) {
     case ContainerOption::directSum: {
-      container = std::make_unique<DirectSum<Particle>>(_boxMin, _boxMax, _cutoff, containerInfo.verletSkinPerTimestep,
+      container = std::make_unique<DirectSum<Particle>>(boxMin, boxMax, _cutoff, containerInfo.verletSkinPerTimestep,
                                                         containerInfo.verletRebuildFrequency);
       break;
     }
 
     case ContainerOption::linkedCells: {
       container = std::make_unique<LinkedCells<Particle>>(
-          _boxMin, _boxMax, _cutoff, containerInfo.verletSkinPerTimestep, containerInfo.verletRebuildFrequency,
+          boxMin, boxMax, _cutoff, containerInfo.verletSkinPerTimestep, containerInfo.verletRebuildFrequency,
           containerInfo.cellSizeFactor, containerInfo.loadEstimator);
       break;
     }
     case ContainerOption::linkedCellsReferences: {
       container = std::make_unique<LinkedCellsReferences<Particle>>(
-          _boxMin, _boxMax, _cutoff, containerInfo.verletSkinPerTimestep, containerInfo.verletRebuildFrequency,
+          boxMin, boxMax, _cutoff, containerInfo.verletSkinPerTimestep, containerInfo.verletRebuildFrequency,
           containerInfo.cellSizeFactor);
       break;
     }
     case ContainerOption::verletLists: {
       container = std::make_unique<VerletLists<Particle>>(
-          _boxMin, _boxMax, _cutoff, containerInfo.verletSkinPerTimestep, containerInfo.verletRebuildFrequency,
+          boxMin, boxMax, _cutoff, containerInfo.verletSkinPerTimestep, containerInfo.verletRebuildFrequency,
           VerletLists<Particle>::BuildVerletListType::VerletSoA, containerInfo.cellSizeFactor);
       break;
     }
     case ContainerOption::verletListsCells: {
       container = std::make_unique<VerletListsCells<Particle, VLCAllCellsNeighborList<Particle>>>(
-          _boxMin, _boxMax, _cutoff, containerInfo.verletSkinPerTimestep, containerInfo.verletRebuildFrequency,
+          boxMin, boxMax, _cutoff, containerInfo.verletSkinPerTimestep, containerInfo.verletRebuildFrequency,
           containerInfo.cellSizeFactor, containerInfo.loadEstimator, VerletListsCellsHelpers::VLCBuildType::soaBuild);
       break;
     }
     case ContainerOption::verletClusterLists: {
       container = std::make_unique<VerletClusterLists<Particle>>(
-          _boxMin, _boxMax, _cutoff, containerInfo.verletSkinPerTimestep, containerInfo.verletRebuildFrequency,
+          boxMin, boxMax, _cutoff, containerInfo.verletSkinPerTimestep, containerInfo.verletRebuildFrequency,
           containerInfo.verletClusterSize, containerInfo.loadEstimator);
       break;
     }
     case ContainerOption::varVerletListsAsBuild: {
       container = std::make_unique<VarVerletLists<Particle, VerletNeighborListAsBuild<Particle>>>(
-          _boxMin, _boxMax, _cutoff, containerInfo.verletSkinPerTimestep, containerInfo.verletRebuildFrequency,
+          boxMin, boxMax, _cutoff, containerInfo.verletSkinPerTimestep, containerInfo.verletRebuildFrequency,
           containerInfo.cellSizeFactor);
       break;
     }
 
     case ContainerOption::pairwiseVerletLists: {
       container = std::make_unique<VerletListsCells<Particle, VLCCellPairNeighborList<Particle>>>(
-          _boxMin, _boxMax, _cutoff, containerInfo.verletSkinPerTimestep, containerInfo.verletRebuildFrequency,
+          boxMin, boxMax, _cutoff, containerInfo.verletSkinPerTimestep, containerInfo.verletRebuildFrequency,
           containerInfo.cellSizeFactor, containerInfo.loadEstimator, VerletListsCellsHelpers::VLCBuildType::soaBuild);
       break;
     }
     case ContainerOption::octree: {
       container =
-          std::make_unique<Octree<Particle>>(_boxMin, _boxMax, _cutoff, containerInfo.verletSkinPerTimestep,
+          std::make_unique<Octree<Particle>>(boxMin, boxMax, _cutoff, containerInfo.verletSkinPerTimestep,
                                              containerInfo.verletRebuildFrequency, containerInfo.cellSizeFactor);
       break;
     }
@@ -161,25 +312,114 @@ std::unique_ptr<autopas::ParticleContainerInterface<Particle>> ContainerSelector
     }
   }
 
+  return container;
+}
+
+template <class Particle>
+std::unique_ptr<autopas::ParticleContainerInterface<Particle>> ContainerSelector<Particle>::generateContainer(
+    ContainerOption containerChoice, ContainerSelectorInfo containerInfo) {
+  auto container = createEmptyContainer(containerChoice, containerInfo, _boxMin, _boxMax);
+
   // copy particles so they do not get lost when container is switched
   if (_currentContainer != nullptr) {
-    // with these assumptions slightly more space is reserved as numParticlesTotal already includes halos
-    const auto numParticlesTotal = _currentContainer->size();
-    const auto numParticlesHalo = autopas::utils::NumParticlesEstimator::estimateNumHalosUniform(
-        numParticlesTotal, _currentContainer->getBoxMin(), _currentContainer->getBoxMax(),
-        _currentContainer->getInteractionLength());
+    copyParticlesFromCurrentContainer(*container);
+  }
+
+  return container;
+}
 
-    container->reserve(numParticlesTotal, numParticlesHalo);
+template <class Particle>
+void ContainerSelector<Particle>::copyParticlesFromCurrentContainer(
+    autopas::ParticleContainerInterface<Particle> &container) {
+  // The exact numbers are known, so no estimate is needed to reserve the space for the new container.
+  const auto numParticlesOwned = _currentContainer->getNumberOfParticles(IteratorBehavior::owned);
+  const auto numParticlesHalo = _currentContainer->getNumberOfParticles(IteratorBehavior::halo);
+  container.reserve(numParticlesOwned, numParticlesHalo);
+
+  // Adding particles is thread safe for all containers, so every thread transfers the share of particles its
+  // iterator visits. The containers sort the particles into their cells on insertion.
+  AUTOPAS_OPENMP(parallel) {
     for (auto particleIter = _currentContainer->begin(IteratorBehavior::ownedOrHalo); particleIter.isValid();
          ++particleIter) {
       // add particle as inner if it is owned
       if (particleIter->isOwned()) {
-        container->addParticle(*particleIter);
+        container.addParticle(*particleIter);
       } else {
-        container->addHaloParticle(*particleIter);
+        container.addHaloParticle(*particleIter);
       }
     }
   }
+}
+
+template <class Particle>
+std::unique_ptr<autopas::ParticleContainerInterface<Particle>> ContainerSelector<Particle>::takeShadowContainer(
+    ContainerOption containerChoice, const ContainerSelectorInfo &containerInfo) {
+  const auto shadowIter = std::find_if(_shadowContainers.begin(), _shadowContainers.end(), [&](const auto &shadow) {
+    // The skin is derived from the info but also checked on the container itself because reusing a container with
+    // a different skin would silently change the physics.
+    return shadow.container->getContainerType() == containerChoice and shadow.info == containerInfo and
+           shadow.container->getVerletSkin() ==
+               containerInfo.verletSkinPerTimestep * static_cast<double>(containerInfo.verletRebuildFrequency);
+  });
+  if (shadowIter == _shadowContainers.end()) {
+    return nullptr;
+  }
+  auto container = std::move(shadowIter->container);
+  _shadowContainerMemory -= shadowIter->memoryEstimate;
+  _shadowContainers.erase(shadowIter);
+  // The particles of the shadow are outdated. Deleting them keeps the allocated cells.
+  container->deleteAllParticles();
+  return container;
+}
+
+template <class Particle>
+void ContainerSelector<Particle>::storeShadowContainer(
+    std::unique_ptr<autopas::ParticleContainerInterface<Particle>> container,
+    const ContainerSelectorInfo &containerInfo) {
+  if (_maxNumShadowContainers == 0 or container == nullptr) {
+    return;
+  }
+  const auto memoryEstimate = container->getMemoryEstimate();
+  _shadowContainers.push_front({containerInfo, std::move(container), memoryEstimate});
+  _shadowContainerMemory += memoryEstimate;
+  evictShadowContainers();
+}
+
+template <class Particle>
+void ContainerSelector<Particle>::evictShadowContainers() {
+  while (not _shadowContainers.empty() and (_shadowContainers.size() > _maxNumShadowContainers or
+                                            _shadowContainerMemory > _shadowContainerMemoryBudget)) {
+    _shadowContainerMemory -= _shadowContainers.back().memoryEstimate;
+    _shadowContainers.pop_back();
+  }
+}
+
+template <class Particle>
+std::unique_ptr<autopas::ParticleContainerInterface<Particle>> ContainerSelector<Particle>::generateSubdomainContainer(
+    ContainerOption containerChoice, ContainerSelectorInfo containerInfo, const std::array<double, 3> &subdomainMin,
+    const std::array<double, 3> &subdomainMax) const {
+  using namespace autopas::utils::ArrayMath::literals;
+
+  auto container = createEmptyContainer(containerChoice, containerInfo, subdomainMin, subdomainMax);
+  if (_currentContainer == nullptr) {
+    return container;
+  }
+
+  const auto interactionLength = container->getInteractionLength();
+  for (auto particleIter = _currentContainer->getRegionIterator(
+           subdomainMin - interactionLength, subdomainMax + interactionLength, IteratorBehavior::ownedOrHalo);
+       particleIter.isValid(); ++particleIter) {
+    // ownership is only determined by the position relative to the subdomain
+    if (utils::inBox(particleIter->getR(), subdomainMin, subdomainMax)) {
+      auto particleCopy = *particleIter;
+      particleCopy.setOwnershipState(OwnershipState::owned);
+      container->template addParticle</* checkInBox */ false>(particleCopy);
+    } else {
+      auto haloParticleCopy = *particleIter;
+      haloParticleCopy.setOwnershipState(OwnershipState::halo);
+      container->template addHaloParticle</* checkInBox */ false>(haloParticleCopy);
+    }
+  }
 
   return container;
 }
@@ -208,7 +448,15 @@ void ContainerSelector<Particle>::selectContainer(ContainerOption containerOptio
   // Only do something if we have no container, a new type is required, or the info changed
   if (_currentContainer == nullptr or _currentContainer->getContainerType() != containerOption or
       _currentInfo != containerInfo) {
-    _currentContainer = std::move(generateContainer(containerOption, containerInfo));
+    auto container = takeShadowContainer(containerOption, containerInfo);
+    if (container != nullptr) {
+      AutoPasLog(DEBUG, "Reusing shadow container {}.", containerOption);
+      copyParticlesFromCurrentContainer(*container);
+    } else {
+      container = generateContainer(containerOption, containerInfo);
+    }
+    storeShadowContainer(std::move(_currentContainer), _currentInfo);
+    _currentContainer = std::move(container);
     _currentInfo = containerInfo;
   }
 }
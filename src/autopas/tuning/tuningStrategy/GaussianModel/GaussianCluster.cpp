@@ -37,7 +37,7 @@ const autopas::GaussianProcess &autopas::GaussianCluster::getCluster(size_t inde
 }
 
 void autopas::GaussianCluster::clear() {
-  for (auto cluster : _clusters) {
+  for (auto &cluster : _clusters) {
     cluster.clear();
   }
   _numEvidence = 0;
@@ -265,7 +265,7 @@ void autopas::GaussianCluster::initClusters() {
 
   GaussianModelTypes::VectorDiscrete currentDiscrete = Eigen::VectorXi::Zero(_dimRestriction.size());
   for (size_t i = 0; i < numClusters; ++i, discreteIncrement(currentDiscrete)) {
-    _clusters.emplace_back(_continuousDims, _sigma, _rng);
+    _clusters.emplace_back(_continuousDims, _sigma, _rng, max_cluster_evidence);
     _discreteVectorMap.emplace_back(currentDiscrete);
   }
 }
@@ -32,6 +32,8 @@ class GaussianCluster {
   static constexpr size_t hp_sample_size = 500;
   // number of hyperparameters
   static constexpr size_t hp_size = 25;
+  // maximum number of evidence per cluster. Older evidence is discarded to bound the cost of refitting.
+  static constexpr size_t max_cluster_evidence = 64;
 
  public:
   /**
@@ -7,6 +7,7 @@
 #include "GaussianHyperparameters.h"
 
 #include <Eigen/Cholesky>
+#include <cmath>
 
 #include "GaussianProcess.h"
 
@@ -30,8 +31,6 @@ autopas::GaussianHyperparameters::~GaussianHyperparameters() = default;
 void autopas::GaussianHyperparameters::precalculate(double sigma, const std::vector<Eigen::VectorXd> &inputs,
                                                     const Eigen::VectorXd &outputs) {
   size_t size = outputs.size();
-  // mean of output shifted to zero
-  Eigen::VectorXd outputCentered = outputs - mean * Eigen::VectorXd::Ones(size);
 
   Eigen::MatrixXd covMat(size, size);
   // calculate covariance matrix
@@ -43,15 +42,60 @@ void autopas::GaussianHyperparameters::precalculate(double sigma, const std::vec
   }
 
   // cholesky decomposition
-  Eigen::LLT<Eigen::MatrixXd> llt = covMat.llt();
-  Eigen::MatrixXd l = llt.matrixL();
+  covMatL = covMat.llt().matrixL();
+
+  updateWeights(outputs);
+}
+
+void autopas::GaussianHyperparameters::appendEvidence(double sigma, const std::vector<Eigen::VectorXd> &inputs) {
+  const long oldSize = covMatL.rows();
+  const auto &newInput = inputs.back();
 
-  // precalculate inverse of covMat and weights for predictions
-  covMatInv = llt.solve(Eigen::MatrixXd::Identity(size, size));
-  weights = covMatInv * outputCentered;
+  // covariances between the new input and all previous inputs
+  Eigen::VectorXd kVec(oldSize);
+  for (long i = 0; i < oldSize; ++i) {
+    kVec[i] = GaussianProcess::kernel(newInput, inputs[i], theta, dimScales);
+  }
+
+  // new row of L: solve L * l = k and complete the diagonal such that the row reproduces the variance
+  const Eigen::VectorXd lVec = covMatL.triangularView<Eigen::Lower>().solve(kVec);
+  const double variance = GaussianProcess::kernel(newInput, newInput, theta, dimScales) + sigma;
+
+  covMatL.conservativeResize(oldSize + 1, oldSize + 1);
+  covMatL.col(oldSize).setZero();
+  covMatL.row(oldSize).head(oldSize) = lVec.transpose();
+  covMatL(oldSize, oldSize) = std::sqrt(variance - lVec.squaredNorm());
+}
+
+void autopas::GaussianHyperparameters::removeFirstEvidence() {
+  const long newSize = covMatL.rows() - 1;
+
+  // The remaining covariance matrix is L22 * L22^T + l * l^T, where l is the first column below the diagonal.
+  // Fold l into L22 via a rank-one update using Givens rotations.
+  Eigen::MatrixXd newL = covMatL.bottomRightCorner(newSize, newSize);
+  Eigen::VectorXd lVec = covMatL.col(0).tail(newSize);
+  for (long k = 0; k < newSize; ++k) {
+    const double r = std::hypot(newL(k, k), lVec[k]);
+    const double c = r / newL(k, k);
+    const double s = lVec[k] / newL(k, k);
+    newL(k, k) = r;
+    const long rest = newSize - k - 1;
+    newL.col(k).tail(rest) = (newL.col(k).tail(rest) + s * lVec.tail(rest)) / c;
+    lVec.tail(rest) = c * lVec.tail(rest) - s * newL.col(k).tail(rest);
+  }
+  covMatL = std::move(newL);
+}
+
+void autopas::GaussianHyperparameters::updateWeights(const Eigen::VectorXd &outputs) {
+  size_t size = outputs.size();
+  // mean of output shifted to zero
+  Eigen::VectorXd outputCentered = outputs - mean * Eigen::VectorXd::Ones(size);
 
-  // likelihood of evidence given parameters
-  score = std::exp(-0.5 * outputCentered.dot(weights)) / l.diagonal().prod();
+  // weights = C^-1 * outputCentered via forward and backward substitution
+  weights = covMatL.triangularView<Eigen::Lower>().solve(outputCentered);
+  // likelihood of evidence given parameters. y^T C^-1 y equals the squared norm of L^-1 y
+  score = std::exp(-0.5 * weights.squaredNorm()) / covMatL.diagonal().prod();
+  covMatL.triangularView<Eigen::Lower>().transpose().solveInPlace(weights);
 
   if (std::isnan(score)) {
     // error score calculation failed
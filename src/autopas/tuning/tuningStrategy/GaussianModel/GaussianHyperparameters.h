@@ -7,6 +7,7 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <vector>
 
 namespace autopas {
 /**
@@ -32,9 +33,9 @@ class GaussianHyperparameters {
   Eigen::VectorXd dimScales;
 
   /**
-   * Covariance Matrix Inverse
+   * Lower triangular Cholesky factor L of the covariance matrix C = L * L^T.
    */
-  Eigen::MatrixXd covMatInv;
+  Eigen::MatrixXd covMatL;
   /**
    * Weights used for predictions
    */
@@ -83,5 +84,26 @@ class GaussianHyperparameters {
    * @param outputs evidence output
    */
   void precalculate(double sigma, const std::vector<Eigen::VectorXd> &inputs, const Eigen::VectorXd &outputs);
+
+  /**
+   * Extend the Cholesky factor by the last input via a rank-one extension in O(n^2).
+   * All other inputs have to be the ones the factor was calculated with.
+   * Weights and score have to be updated afterwards via updateWeights().
+   * @param sigma assumed noise
+   * @param inputs evidence input including the new input at the back
+   */
+  void appendEvidence(double sigma, const std::vector<Eigen::VectorXd> &inputs);
+
+  /**
+   * Remove the first input from the Cholesky factor via a rank-one update in O(n^2).
+   * Weights and score have to be updated afterwards via updateWeights().
+   */
+  void removeFirstEvidence();
+
+  /**
+   * Recalculate weights and score from the current Cholesky factor in O(n^2).
+   * @param outputs evidence output matching the inputs of the Cholesky factor
+   */
+  void updateWeights(const Eigen::VectorXd &outputs);
 };
 }  // namespace autopas
@@ -8,13 +8,14 @@
 
 #include "autopas/utils/WrapOpenMP.h"
 
-autopas::GaussianProcess::GaussianProcess(size_t dims, double sigma, Random &rngRef)
+autopas::GaussianProcess::GaussianProcess(size_t dims, double sigma, Random &rngRef, size_t maxEvidence)
     : _inputs(),
       _outputs(),
       _dims(dims),
       _evidenceMinValue(0),
       _evidenceMaxValue(0),
       _sigma(sigma),
+      _maxEvidence(maxEvidence),
       _hypers(),
       _rng(rngRef) {
   tuneHyperparameters();
@@ -47,6 +48,8 @@ void autopas::GaussianProcess::addEvidence(const autopas::GaussianProcess::Vecto
         "GaussianProcess.addEvidence: size of input {} does not match specified dimensions {}", input.size(), _dims);
   }
 
+  // hyperparameter means are sampled from the output range, so a wider range requires new samples
+  const bool outputRangeGrew = _inputs.empty() or output < _evidenceMinValue or output > _evidenceMaxValue;
   if (_inputs.empty()) {
     // first evidence
     _evidenceMinValue = _evidenceMaxValue = output;
@@ -64,12 +67,32 @@ void autopas::GaussianProcess::addEvidence(const autopas::GaussianProcess::Vecto
   // extend output vector
   _outputs.conservativeResize(newSize, Eigen::NoChange_t());
   _outputs(newSize - 1) = output;
+  ++_numEvidenceSinceTuning;
 
-  if (tuneHypers) {
-    tuneHyperparameters();
-  } else {
+  const bool removeFirst = _inputs.size() > _maxEvidence;
+  const size_t numKept = removeFirst ? _inputs.size() - 1 : _inputs.size();
+  // Resampling costs O(n^3) per sample. Doing it only once half of the evidence is new keeps the amortized cost at
+  // O(n^2).
+  const bool resample = _hypers.empty() or numKept <= hp_full_tuning_evidence or outputRangeGrew or
+                        2 * _numEvidenceSinceTuning >= numKept;
+
+  if (tuneHypers and not resample) {
+    updateHyperparameters(removeFirst);
+  }
+
+  if (removeFirst) {
+    _inputs.erase(_inputs.begin());
+    _outputs = _outputs.tail(numKept).eval();
+    updateEvidenceMinMax();
+  }
+
+  if (not tuneHypers) {
     // hyperparameters should be recalculated
     _hypers.clear();
+  } else if (resample) {
+    tuneHyperparameters();
+  } else {
+    normalizeHyperparameters();
   }
 }
 
@@ -122,8 +145,10 @@ double autopas::GaussianProcess::predictVar(const autopas::GaussianProcess::Vect
     return getDefaultVar();
   } else {
     for (const auto &hyper : _hypers) {
-      auto kVec = kernelVector(input, hyper.theta, hyper.dimScales);
-      result += hyper.score * (kernel(input, input, hyper.theta, hyper.dimScales) - kVec.dot(hyper.covMatInv * kVec));
+      // k^T C^-1 k equals the squared norm of L^-1 k
+      const Vector lInvK =
+          hyper.covMatL.triangularView<Eigen::Lower>().solve(kernelVector(input, hyper.theta, hyper.dimScales));
+      result += hyper.score * (kernel(input, input, hyper.theta, hyper.dimScales) - lInvK.squaredNorm());
     }
   }
 
@@ -222,6 +247,7 @@ void autopas::GaussianProcess::setHyperparameters(
     const std::vector<autopas::GaussianProcess::Vector> &sample_dimScales) {
   size_t hyperSize = sample_means.size();
   _hypers.clear();
+  _numEvidenceSinceTuning = 0;
 
   // initialize hyperparameter samples
   _hypers.reserve(hyperSize);
@@ -269,6 +295,7 @@ void autopas::GaussianProcess::tuneHyperparameters() {
   // number of evidence
   size_t newSize = _inputs.size();
   _hypers.clear();
+  _numEvidenceSinceTuning = 0;
 
   // if no evidence
   if (newSize == 0) {
@@ -285,6 +312,27 @@ void autopas::GaussianProcess::tuneHyperparameters() {
   normalizeHyperparameters();
 }
 
+void autopas::GaussianProcess::updateHyperparameters(bool removeFirst) {
+  const auto numKept = removeFirst ? _outputs.size() - 1 : _outputs.size();
+  const Vector keptOutputs = _outputs.tail(numKept);
+
+  AUTOPAS_OPENMP(parallel for schedule(dynamic))
+  for (size_t t = 0; t < _hypers.size(); ++t) {
+    _hypers[t].appendEvidence(_sigma, _inputs);
+    if (removeFirst) {
+      _hypers[t].removeFirstEvidence();
+    }
+    _hypers[t].updateWeights(keptOutputs);
+  }
+}
+
+void autopas::GaussianProcess::updateEvidenceMinMax() {
+  Eigen::Index maxIndex{0};
+  _evidenceMaxValue = _outputs.maxCoeff(&maxIndex);
+  _evidenceMinValue = _outputs.minCoeff();
+  _evidenceMaxVector = _inputs[maxIndex];
+}
+
 double autopas::GaussianProcess::kernel(const autopas::GaussianProcess::Vector &input1,
                                         const autopas::GaussianProcess::Vector &input2, double theta,
                                         const autopas::GaussianProcess::Vector &dimScale) {
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <limits>
 #include <utility>
 
 #include "AcquisitionFunction.h"
@@ -26,6 +27,11 @@ namespace autopas {
  *
  * Currently the squared exponential kernel is used.
  * TODO: maybe offer some options.
+ *
+ * Hyperparameters are resampled from scratch only while little evidence is available, when the range of outputs
+ * grows, or when the evidence doubled since the last resampling. Otherwise, the kept hyperparameters are updated
+ * incrementally via rank-one updates of their Cholesky factors. Together with the optional bound on the evidence,
+ * where the oldest evidence is dropped first, this keeps the cost of adding evidence bounded.
  */
 class GaussianProcess {
   friend GaussianHyperparameters;
@@ -36,6 +42,8 @@ class GaussianProcess {
   static constexpr size_t hp_sample_size = 10000;
   // number of hyperparameters
   static constexpr size_t hp_size = 100;
+  // up to this number of evidence hyperparameters are always resampled
+  static constexpr size_t hp_full_tuning_evidence = 8;
 
  public:
   /**
@@ -43,8 +51,10 @@ class GaussianProcess {
    * @param dims number of input dimensions
    * @param sigma fixed noise
    * @param rngRef reference to rng
+   * @param maxEvidence maximum number of evidence kept. If exceeded the oldest evidence is discarded.
    */
-  GaussianProcess(size_t dims, double sigma, Random &rngRef);
+  GaussianProcess(size_t dims, double sigma, Random &rngRef,
+                  size_t maxEvidence = std::numeric_limits<size_t>::max());
 
   virtual ~GaussianProcess();
 
@@ -74,6 +84,7 @@ class GaussianProcess {
   /**
    * Provide a input-output pair as evidence.
    * Each evidence improve the quality of future predictions.
+   * If more than maxEvidence evidence are stored afterwards, the oldest evidence is discarded.
    * @param input x
    * @param output f(x)
    * @param tuneHypers if false hyperparemeters need to be set manually
@@ -188,6 +199,18 @@ class GaussianProcess {
    */
   void tuneHyperparameters();
 
+  /**
+   * Update the current hyperparameters to the last evidence appended to _inputs and _outputs.
+   * Costs O(n^2) per hyperparameter.
+   * @param removeFirst true if the first evidence is about to be discarded
+   */
+  void updateHyperparameters(bool removeFirst);
+
+  /**
+   * Recalculate the smallest and greatest evidence output and the greatest input.
+   */
+  void updateEvidenceMinMax();
+
   /**
    * Kernel function to describe similarity between two inputs
    * using given hyperparameters.
@@ -236,6 +259,16 @@ class GaussianProcess {
    */
   const double _sigma;
 
+  /**
+   * Maximum number of evidence kept.
+   */
+  const size_t _maxEvidence;
+
+  /**
+   * Number of evidence added since the hyperparameters were last resampled.
+   */
+  size_t _numEvidenceSinceTuning{0};
+
   /**
    * Sampled hyperparameters including precalculated matrices and score
    */
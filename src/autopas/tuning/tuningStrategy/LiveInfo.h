@@ -9,9 +9,19 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
 #include <limits>
+#include <memory>
+#include <string>
+#include <typeinfo>
 #include <variant>
 
+#ifdef __GNUG__
+#include <cxxabi.h>
+#endif
+
 #include "autopas/containers/ParticleContainerInterface.h"
 #include "autopas/options/ContainerOption.h"
 #include "autopas/options/DataLayoutOption.h"
@@ -70,6 +80,7 @@ class LiveInfo {
    * divided by the average number of particles per blurred cell. A blurred cell is exactly 1/27th of the domain.
    * - threadCount: The number of threads that can be used.
    * - rebuildFrequency: The current verlet-rebuild-frequency of the simulation.
+   * - functorTypeHash: Hash of the functor's type name. Allows to tell apart measurements of different functors.
    *
    * @tparam Particle The type of particle the container stores.
    * @tparam PairwiseFunctor The type of functor.
@@ -213,6 +224,8 @@ class LiveInfo {
     constexpr size_t particleSizeNeededByFunctor = calculateParticleSizeNeededByFunctor<Particle, PairwiseFunctor>(
         std::make_index_sequence<PairwiseFunctor::getNeededAttr().size()>());
     infos["particleSizeNeededByFunctor"] = particleSizeNeededByFunctor;
+
+    infos["functorTypeHash"] = stableTypeHash<PairwiseFunctor>();
   }
 
   /**
@@ -327,6 +340,31 @@ class LiveInfo {
   }
 
  private:
+  /**
+   * Hash of the demangled name of a type that is stable across runs, builds, and standard library implementations.
+   * This is not the case for std::hash, so it can not be used for values that are written to disk.
+   * @tparam T
+   * @return 64-bit FNV-1a hash of the type name.
+   */
+  template <class T>
+  static size_t stableTypeHash() {
+    std::string typeName{typeid(T).name()};
+#ifdef __GNUG__
+    int status{-1};
+    const std::unique_ptr<char, void (*)(void *)> demangled{
+        abi::__cxa_demangle(typeName.c_str(), nullptr, nullptr, &status), std::free};
+    if (status == 0) {
+      typeName = demangled.get();
+    }
+#endif
+    std::uint64_t hash{14695981039346656037ull};
+    for (const auto c : typeName) {
+      hash ^= static_cast<unsigned char>(c);
+      hash *= 1099511628211ull;
+    }
+    return static_cast<size_t>(hash);
+  }
+
   /**
    * Private helper to calculate the particle size needed by a functor. This is the sum of the size of the type of all
    * needed attributes.
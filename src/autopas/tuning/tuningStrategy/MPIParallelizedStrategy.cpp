@@ -6,6 +6,7 @@
 
 #include "MPIParallelizedStrategy.h"
 
+#include <algorithm>
 #include <cstddef>
 
 #include "autopas/tuning/Configuration.h"
@@ -18,11 +19,34 @@ namespace autopas {
 
 MPIParallelizedStrategy::MPIParallelizedStrategy(const Configuration &fallbackConfiguration,
                                                  const AutoPas_MPI_Comm &comm, double mpiTuningMaxDifferenceForBucket,
-                                                 double mpiTuningWeightForMaxDensity)
+                                                 double mpiTuningWeightForMaxDensity, bool shareEvidence)
     : _comm(comm),
       _fallbackConfiguration(fallbackConfiguration),
       _mpiTuningMaxDifferenceForBucket(mpiTuningMaxDifferenceForBucket),
-      _mpiTuningWeightForMaxDensity(mpiTuningWeightForMaxDensity) {}
+      _mpiTuningWeightForMaxDensity(mpiTuningWeightForMaxDensity),
+      _shareEvidence(shareEvidence) {}
+
+MPIParallelizedStrategy::~MPIParallelizedStrategy() {
+  int finalized{0};
+  AutoPas_MPI_Finalized(&finalized);
+  if (not finalized) {
+    completeEvidenceExchange();
+  }
+}
+
+void MPIParallelizedStrategy::addEvidence(const Configuration &configuration, const Evidence &evidence) {
+  if (not _shareEvidence) {
+    return;
+  }
+  // The slowest rank determines the runtime of the whole simulation, so keep the worst value of each configuration.
+  const auto [iter, inserted] = _bucketEvidence.try_emplace(configuration, evidence.value);
+  if (not inserted) {
+    iter->second = std::max(iter->second, evidence.value);
+  }
+  if (not _unsharedEvidence.has_value() or evidence.value < _unsharedEvidence->second) {
+    _unsharedEvidence = {configuration, evidence.value};
+  }
+}
 
 bool MPIParallelizedStrategy::optimizeSuggestions(std::vector<Configuration> &configQueue,
                                                   const EvidenceCollection &evidenceCollection) {
@@ -32,18 +56,31 @@ bool MPIParallelizedStrategy::optimizeSuggestions(std::vector<Configuration> &co
     _bucket = _comm;
   }
 
+  // Collect what the other ranks measured while we were sampling and pass on our newest evidence.
+  if (_shareEvidence) {
+    completeEvidenceExchange();
+    startEvidenceExchange();
+  }
+
   // All ranks should stay in tuning mode equally long so that none settles on an optimum
   // before the other's data is there.
-  const auto [myBestConf, myBestEvidence] = evidenceCollection.getLatestOptimalConfiguration();
-  const auto globallyBestConfig =
-      utils::AutoPasConfigurationCommunicator::findGloballyBestConfiguration(_bucket, myBestConf, myBestEvidence.value);
+  const auto globallyBestConfig = [&]() {
+    if (_shareEvidence) {
+      // All ranks already know the evidence of the bucket, so no further communication is necessary.
+      return getBestBucketConfiguration().value_or(_fallbackConfiguration);
+    }
+    const auto [myBestConf, myBestEvidence] = evidenceCollection.getLatestOptimalConfiguration();
+    return utils::AutoPasConfigurationCommunicator::findGloballyBestConfiguration(_bucket, myBestConf,
+                                                                                  myBestEvidence.value);
+  }();
 
   const auto myQueueSize = static_cast<unsigned int>(configQueue.size());
   unsigned int globallyLongestQueueSize{};
   AutoPas_MPI_Allreduce(&myQueueSize, &globallyLongestQueueSize, 1, AUTOPAS_MPI_UNSIGNED_INT, AUTOPAS_MPI_MAX, _bucket);
   // if our queue is about to be emptied but others still have things to test, stretch our queue by inserting the
-  // current global optimum
-  if (myQueueSize == 1 and globallyLongestQueueSize > myQueueSize) {
+  // current global optimum. This includes empty queues, otherwise ranks with fewer configurations would leave the
+  // tuning phase and the collective operations above early.
+  if (myQueueSize <= 1 and globallyLongestQueueSize > myQueueSize) {
     // depending on if the global optimum is applicable to our subdomain insert this or the fallback.
     if (_rejectedConfigurations.count(globallyBestConfig) == 0) {
       // insert at the front so that the remaining config is at the back and picked next.
@@ -53,6 +90,20 @@ bool MPIParallelizedStrategy::optimizeSuggestions(std::vector<Configuration> &co
       configQueue.insert(configQueue.begin(), _fallbackConfiguration);
     }
   }
+  // If everyone is done, all ranks test the best configuration of the bucket so that they end on the same optimum.
+  if (_shareEvidence and globallyLongestQueueSize == 0 and not _sharedOptimumTested) {
+    _sharedOptimumTested = true;
+    // Wait for the evidence of the last configurations so that all ranks agree on the optimum.
+    completeEvidenceExchange();
+    const auto sharedOptimum = getBestBucketConfiguration();
+    if (sharedOptimum.has_value() and _rejectedConfigurations.count(*sharedOptimum) == 0) {
+      configQueue.push_back(*sharedOptimum);
+    } else {
+      _usingFallbackConfig = true;
+      configQueue.push_back(_fallbackConfiguration);
+    }
+    AutoPasLog(DEBUG, "Testing the shared optimum {} of the bucket.", configQueue.back().toShortString());
+  }
   // make sure not everyone is in fallback mode.
   bool everyoneUsingFallback{false};
   AutoPas_MPI_Reduce(&_usingFallbackConfig, &everyoneUsingFallback, 1, AUTOPAS_MPI_CXX_BOOL, AUTOPAS_MPI_LAND, 0,
@@ -108,6 +159,12 @@ bool MPIParallelizedStrategy::reset(size_t iteration, size_t tuningPhase, std::v
   // clear rejects since they now might be valid.
   _rejectedConfigurations.clear();
 
+  // Finish the last exchange of the previous tuning phase before the buckets are rebuilt.
+  completeEvidenceExchange();
+  _bucketEvidence.clear();
+  _unsharedEvidence.reset();
+  _sharedOptimumTested = false;
+
   // Rebuild the grouping (_bucket) of ranks according to subdomain similarity.
   autopas::utils::AutoPasConfigurationCommunicator::distributeRanksInBuckets(
       _comm, &_bucket, _smoothedHomogeneity, _maxDensity, _mpiTuningMaxDifferenceForBucket,
@@ -151,6 +208,51 @@ void MPIParallelizedStrategy::receiveSmoothedHomogeneityAndMaxDensity(double hom
 
 const AutoPas_MPI_Comm &MPIParallelizedStrategy::getBucket() const { return _bucket; }
 
+const std::map<Configuration, long> &MPIParallelizedStrategy::getBucketEvidence() const { return _bucketEvidence; }
+
+void MPIParallelizedStrategy::completeEvidenceExchange() {
+  if (_evidenceRequest == AUTOPAS_MPI_REQUEST_NULL) {
+    return;
+  }
+  AutoPas_MPI_Wait(&_evidenceRequest, AUTOPAS_MPI_STATUS_IGNORE);
+  for (const auto &serialized : _evidenceReceiveBuffer) {
+    const auto [configuration, value] =
+        utils::AutoPasConfigurationCommunicator::deserializeConfigurationAndValue(serialized);
+    // negative values mark ranks that had nothing new to share
+    if (value < 0) {
+      continue;
+    }
+    const auto [iter, inserted] = _bucketEvidence.try_emplace(configuration, value);
+    if (not inserted) {
+      iter->second = std::max(iter->second, value);
+    }
+  }
+}
+
+void MPIParallelizedStrategy::startEvidenceExchange() {
+  int numRanksInBucket{};
+  AutoPas_MPI_Comm_size(_bucket, &numRanksInBucket);
+  _evidenceReceiveBuffer.resize(numRanksInBucket);
+  _evidenceSendBuffer =
+      _unsharedEvidence.has_value()
+          ? utils::AutoPasConfigurationCommunicator::serializeConfigurationAndValue(_unsharedEvidence->first,
+                                                                                    _unsharedEvidence->second)
+          : utils::AutoPasConfigurationCommunicator::serializeConfigurationAndValue(_fallbackConfiguration, -1);
+  _unsharedEvidence.reset();
+  AutoPas_MPI_Iallgather(_evidenceSendBuffer.data(), _evidenceSendBuffer.size(), AUTOPAS_MPI_BYTE,
+                         _evidenceReceiveBuffer.data(), _evidenceSendBuffer.size(), AUTOPAS_MPI_BYTE, _bucket,
+                         &_evidenceRequest);
+}
+
+std::optional<Configuration> MPIParallelizedStrategy::getBestBucketConfiguration() const {
+  const auto best = std::min_element(_bucketEvidence.begin(), _bucketEvidence.end(),
+                                     [](const auto &lhs, const auto &rhs) { return lhs.second < rhs.second; });
+  if (best == _bucketEvidence.end()) {
+    return std::nullopt;
+  }
+  return best->first;
+}
+
 TuningStrategyOption MPIParallelizedStrategy::getOptionType() const {
   return TuningStrategyOption::mpiDivideAndConquer;
 }
@@ -7,6 +7,8 @@
 #pragma once
 
 #include <cstddef>
+#include <map>
+#include <optional>
 #include <random>
 #include <type_traits>
 #include <vector>
@@ -34,6 +36,13 @@ namespace autopas {
  *
  * The actual splitting of the search space and details of the communication logic is not currently handled by
  * this class, but by AutoPasConfigurationCommunicator.
+ *
+ * If evidence sharing is enabled, every new piece of evidence is sent to all ranks of the bucket with a non-blocking
+ * allgather. The exchange started when switching to the next configuration is completed when switching to the one
+ * after, so it overlaps with the sampling iterations. Ranks that are done with their part of the queue retest the best
+ * configuration of the bucket. When all ranks are done, every rank tests the best configuration of the bucket one last
+ * time. Thus, all ranks end the tuning phase on the shared optimum unless they measured one of their own
+ * configurations to be faster on their subdomain.
  */
 class MPIParallelizedStrategy : public TuningStrategyInterface {
  public:
@@ -44,9 +53,18 @@ class MPIParallelizedStrategy : public TuningStrategyInterface {
    * @param comm The communicator holding all ranks which participate in this tuning strategy.
    * @param mpiTuningMaxDifferenceForBucket
    * @param mpiTuningWeightForMaxDensity
+   * @param shareEvidence Whether evidence is exchanged between the ranks of a bucket.
    */
   MPIParallelizedStrategy(const Configuration &fallbackConfiguration, const AutoPas_MPI_Comm &comm,
-                          double mpiTuningMaxDifferenceForBucket, double mpiTuningWeightForMaxDensity);
+                          double mpiTuningMaxDifferenceForBucket, double mpiTuningWeightForMaxDensity,
+                          bool shareEvidence = false);
+
+  /**
+   * Destructor. Completes any pending evidence exchange.
+   */
+  ~MPIParallelizedStrategy() override;
+
+  void addEvidence(const Configuration &configuration, const Evidence &evidence) override;
 
   TuningStrategyOption getOptionType() const override;
 
@@ -68,6 +86,13 @@ class MPIParallelizedStrategy : public TuningStrategyInterface {
    */
   const AutoPas_MPI_Comm &getBucket() const;
 
+  /**
+   * Get the best evidence value of every configuration that any rank of the bucket measured in this tuning phase.
+   * Only contains the exchanges that have been completed so far.
+   * @return
+   */
+  const std::map<Configuration, long> &getBucketEvidence() const;
+
   /**
    * Create a resilient configuration that should always be applicable.
    *
@@ -81,6 +106,23 @@ class MPIParallelizedStrategy : public TuningStrategyInterface {
                                                    const InteractionTypeOption &interactionType);
 
  private:
+  /**
+   * Waits for the pending evidence exchange and merges the received evidence into _bucketEvidence.
+   */
+  void completeEvidenceExchange();
+
+  /**
+   * Sends the evidence that was collected locally since the last exchange to all ranks in the bucket.
+   * The exchange is non-blocking and has to be completed via completeEvidenceExchange().
+   */
+  void startEvidenceExchange();
+
+  /**
+   * Picks the configuration with the best evidence in the bucket.
+   * @return The configuration or nothing if there is no evidence yet.
+   */
+  [[nodiscard]] std::optional<Configuration> getBestBucketConfiguration() const;
+
   /**
    * The smoothed homogeneity of the whole simulation.
    * See SimilarityFunctions::calculateHomogeneityAndMaxDensity().
@@ -131,5 +173,33 @@ class MPIParallelizedStrategy : public TuningStrategyInterface {
    * Random device used to determine the configuration if there are more ranks than configurations.
    */
   std::mt19937 _rng{std::random_device()()};
+  /**
+   * Whether evidence is exchanged between the ranks of a bucket.
+   */
+  bool _shareEvidence;
+  /**
+   * Best evidence value of all configurations the bucket measured in this tuning phase.
+   */
+  std::map<Configuration, long> _bucketEvidence{};
+  /**
+   * Best local evidence collected since the last exchange was started.
+   */
+  std::optional<std::pair<Configuration, long>> _unsharedEvidence{};
+  /**
+   * Send buffer of the pending exchange. Must stay alive until the exchange is completed.
+   */
+  utils::AutoPasConfigurationCommunicator::SerializedConfigurationAndValue _evidenceSendBuffer{};
+  /**
+   * Receive buffer of the pending exchange with one entry per rank in the bucket.
+   */
+  std::vector<utils::AutoPasConfigurationCommunicator::SerializedConfigurationAndValue> _evidenceReceiveBuffer{};
+  /**
+   * Request handle of the pending exchange.
+   */
+  AutoPas_MPI_Request _evidenceRequest{AUTOPAS_MPI_REQUEST_NULL};
+  /**
+   * Whether the final round, where all ranks test the best configuration of the bucket, was already started.
+   */
+  bool _sharedOptimumTested{false};
 };
 }  // namespace autopas
@@ -99,8 +99,12 @@ long PredictiveTuning::linePrediction(size_t iteration, size_t tuningPhase, cons
   } else
     // if there is enough evidenceVec calculate new prediction function
     if (evidenceVec.size() >= _minNumberOfEvidence) {
-      const auto &[traversal1Iteration, traversal1TuningPhase, traversal1Time] = evidenceVec[evidenceVec.size() - 1];
-      const auto &[traversal2Iteration, traversal2TuningPhase, traversal2Time] = evidenceVec[evidenceVec.size() - 2];
+      const auto &traversal1Evidence = evidenceVec[evidenceVec.size() - 1];
+      const auto &traversal2Evidence = evidenceVec[evidenceVec.size() - 2];
+      const auto traversal1Iteration = traversal1Evidence.iteration;
+      const auto traversal1Time = traversal1Evidence.value;
+      const auto traversal2Iteration = traversal2Evidence.iteration;
+      const auto traversal2Time = traversal2Evidence.value;
 
       const auto gradient = static_cast<double>(traversal1Time - traversal2Time) /
                             static_cast<double>(traversal1Iteration - traversal2Iteration);
@@ -153,7 +157,8 @@ long PredictiveTuning::linearRegression(size_t iteration, size_t tuningPhase, co
 
       bool numericOverflow = false;
       for (auto i = evidenceVec.size() - _minNumberOfEvidence; i < evidenceVec.size(); i++) {
-        const auto &[evidenceIteration, evidenceTuningPhase, evidenceValue] = evidenceVec[i];
+        const auto evidenceIteration = evidenceVec[i].iteration;
+        const auto evidenceValue = evidenceVec[i].value;
         const auto iterationMultTimeI = utils::Math::safeMul(static_cast<long>(evidenceIteration), evidenceValue);
         iterationMultTime = utils::Math::safeAdd(iterationMultTime, iterationMultTimeI);
         // if any of the safe operations overflow we can directly move to the next config
@@ -260,10 +265,9 @@ long PredictiveTuning::newtonPolynomial(size_t iteration, size_t tuningPhase, co
       std::vector<double> ithColumn(lengthIthColumn);
       for (unsigned int j = 0; j < lengthIthColumn; j++) {
         if (i == 0) {
-          const auto &[evidenceIteration, evidenceTuningPhase, evidenceValue] =
-              evidenceVec[numberOfEvidence - _minNumberOfEvidence + j];
-          ithColumn[j] = static_cast<double>(evidenceValue);
-          iterationValues[j] = evidenceIteration;
+          const auto &evidence = evidenceVec[numberOfEvidence - _minNumberOfEvidence + j];
+          ithColumn[j] = static_cast<double>(evidence.value);
+          iterationValues[j] = evidence.iteration;
         } else {
           // cast integer to decimal because this division contains small numbers which would cause precision lose
           ithColumn[j] = (interimCalculation[i - 1][j + 1] - interimCalculation[i - 1][j]) /
@@ -330,10 +334,8 @@ long PredictiveTuning::lastResult(size_t tuningPhase, const Configuration &confi
     return functionParams[0];
   } else {
     if (evidenceVec.size() >= _minNumberOfEvidence) {
-      const auto &[traversalIteration, traversalTuningPhase, traversalTime] = evidenceVec[evidenceVec.size() - 1];
-
       // the prediction is the last traversal time
-      const long prediction = traversalTime;
+      const long prediction = evidenceVec.back().value;
 
       functionParams.clear();
       functionParams.emplace_back(prediction);
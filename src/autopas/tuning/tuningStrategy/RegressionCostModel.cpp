@@ -0,0 +1,243 @@
+/**
+ * @file RegressionCostModel.cpp
+ * @date 18.10.26
+ */
+
+#include "RegressionCostModel.h"
+
+#include <Eigen/Cholesky>
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <type_traits>
+
+#include "autopas/containers/CompatibleLoadEstimators.h"
+#include "autopas/containers/CompatibleTraversals.h"
+#include "autopas/tuning/tuningStrategy/TuningLogEntry.h"
+#include "autopas/utils/NumberSetFinite.h"
+#include "autopas/utils/logging/Logger.h"
+
+namespace {
+/**
+ * Number of scenario features produced by encodeLiveInfo().
+ */
+constexpr size_t numLiveFeatures = 8;
+
+/**
+ * Weight of the ridge regularization. Keeps the normal equations solvable while few samples are known.
+ */
+constexpr double regularization = 1e-3;
+}  // namespace
+
+namespace autopas {
+
+RegressionCostModel::RegressionCostModel(const InteractionTypeOption &interactionType, double pruneFactor,
+                                         const std::string &trainingLogFileName)
+    : _interactionType(interactionType), _pruneFactor(pruneFactor), _encoder() {
+  // Encode all options and not only the ones of the search space so that the model does not depend on it.
+  const auto allLoadEstimators = LoadEstimatorOption::getAllOptions();
+  for (const auto &containerOption : ContainerOption::getAllOptions()) {
+    for (const auto &traversalOption :
+         compatibleTraversals::allCompatibleTraversals(containerOption, _interactionType)) {
+      for (const auto &loadEstimatorOption :
+           loadEstimators::getApplicableLoadEstimators(containerOption, traversalOption, allLoadEstimators)) {
+        _containerTraversalEstimatorOptions.emplace_back(containerOption, traversalOption, loadEstimatorOption);
+      }
+    }
+  }
+  const auto allDataLayouts = DataLayoutOption::getAllOptions();
+  const auto allNewton3Options = Newton3Option::getAllOptions();
+  const std::vector<DataLayoutOption> dataLayoutOptions{allDataLayouts.begin(), allDataLayouts.end()};
+  const std::vector<Newton3Option> newton3Options{allNewton3Options.begin(), allNewton3Options.end()};
+  // The cell size factor is encoded as is, so its allowed values do not matter here.
+  _encoder.setAllowedOptions(_containerTraversalEstimatorOptions, dataLayoutOptions, newton3Options,
+                             NumberSetFinite<double>{1.});
+
+  const auto oneHotDims = _encoder.getOneHotDims();
+  const auto numFeatures = oneHotDims * numLiveFeatures;
+  _gramMatrix = Eigen::MatrixXd::Zero(numFeatures, numFeatures);
+  _rhs = Eigen::VectorXd::Zero(numFeatures);
+  _weights = Eigen::VectorXd::Zero(numFeatures);
+  _oneHotObservations = Eigen::VectorXd::Zero(oneHotDims);
+
+  if (not trainingLogFileName.empty()) {
+    trainFromTuningLog(trainingLogFileName);
+    AutoPasLog(DEBUG, "RegressionCostModel: Trained with {} samples from {}.", _numTrainingSamples, trainingLogFileName);
+  }
+}
+
+TuningStrategyOption RegressionCostModel::getOptionType() const { return TuningStrategyOption::regressionCostModel; }
+
+void RegressionCostModel::addEvidence(const Configuration &configuration, const Evidence &evidence) {
+  if (_currentLiveFeatures.has_value()) {
+    train(*_currentLiveFeatures, configuration, evidence.value);
+  }
+}
+
+bool RegressionCostModel::optimizeSuggestions(std::vector<Configuration> & /*configQueue*/,
+                                              const EvidenceCollection & /*evidenceCollection*/) {
+  // The queue is only ranked at the beginning of a tuning phase.
+  return false;
+}
+
+bool RegressionCostModel::reset(size_t /*iteration*/, size_t /*tuningPhase*/, std::vector<Configuration> &configQueue,
+                                const EvidenceCollection & /*evidenceCollection*/) {
+  if (not _currentLiveFeatures.has_value() or _numTrainingSamples == 0) {
+    return false;
+  }
+
+  std::vector<std::pair<Configuration, double>> predictedConfigurations;
+  std::vector<Configuration> unknownConfigurations;
+  for (const auto &configuration : configQueue) {
+    if (const auto prediction = predict(*_currentLiveFeatures, configuration); prediction.has_value()) {
+      predictedConfigurations.emplace_back(configuration, *prediction);
+    } else {
+      unknownConfigurations.push_back(configuration);
+    }
+  }
+  if (predictedConfigurations.empty()) {
+    return false;
+  }
+
+  // The queue is processed from the back, so sort descending to test the best prediction first.
+  std::sort(predictedConfigurations.begin(), predictedConfigurations.end(),
+            [](const auto &lhs, const auto &rhs) { return lhs.second > rhs.second; });
+  const auto bestPrediction = predictedConfigurations.back().second;
+  predictedConfigurations.erase(
+      std::remove_if(predictedConfigurations.begin(), predictedConfigurations.end(),
+                     [&](const auto &predictedConfiguration) {
+                       return predictedConfiguration.second > _pruneFactor * bestPrediction;
+                     }),
+      predictedConfigurations.end());
+
+  // Unknown configurations are tested after all predicted ones.
+  configQueue = std::move(unknownConfigurations);
+  for (const auto &[configuration, prediction] : predictedConfigurations) {
+    configQueue.push_back(configuration);
+  }
+  AutoPasLog(DEBUG, "RegressionCostModel: Best prediction {} for {}. {} configurations left after pruning.",
+             bestPrediction, configQueue.back().toShortString(), configQueue.size());
+  return false;
+}
+
+bool RegressionCostModel::needsLiveInfo() const { return true; }
+
+void RegressionCostModel::receiveLiveInfo(const LiveInfo &info) { _currentLiveFeatures = encodeLiveInfo(info); }
+
+void RegressionCostModel::train(const LiveInfo &info, const Configuration &configuration, long value) {
+  train(encodeLiveInfo(info), configuration, value);
+}
+
+size_t RegressionCostModel::trainFromTuningLog(const std::string &fileName) {
+  std::ifstream in{fileName};
+  if (not in.is_open()) {
+    AutoPasLog(WARN, "RegressionCostModel: Could not open training log {}.", fileName);
+    return 0;
+  }
+
+  const auto numSamplesBefore = _numTrainingSamples;
+  std::optional<Eigen::VectorXd> liveFeatures{};
+  std::string line;
+  while (std::getline(in, line)) {
+    std::stringstream stream{line};
+    std::string type;
+    std::getline(stream, type, ' ');
+
+    if (type == "liveInfo") {
+      liveFeatures = encodeLiveInfo(tuningLogEntry::readLiveInfo(stream));
+    } else if (type == "evidence" and liveFeatures.has_value()) {
+      const auto &[time, iteration, configuration] = tuningLogEntry::readEvidence(stream);
+      train(*liveFeatures, configuration, time);
+    }
+  }
+  return _numTrainingSamples - numSamplesBefore;
+}
+
+std::optional<double> RegressionCostModel::predict(const LiveInfo &info, const Configuration &configuration) {
+  return predict(encodeLiveInfo(info), configuration);
+}
+
+size_t RegressionCostModel::getNumTrainingSamples() const { return _numTrainingSamples; }
+
+Eigen::VectorXd RegressionCostModel::encodeLiveInfo(const LiveInfo &info) {
+  const auto &infos = info.get();
+  // helper to read any numeric info as double with a fallback of 0 if it was not gathered
+  const auto get = [&](const std::string &name) {
+    const auto iter = infos.find(name);
+    if (iter == infos.end()) {
+      return 0.;
+    }
+    return std::visit(
+        [](const auto &value) {
+          if constexpr (std::is_arithmetic_v<std::decay_t<decltype(value)>>) {
+            return static_cast<double>(value);
+          } else {
+            return 0.;
+          }
+        },
+        iter->second);
+  };
+
+  Eigen::VectorXd features(numLiveFeatures);
+  // Quantities that span orders of magnitude enter logarithmically.
+  features << 1., std::log1p(get("numParticles")), std::log1p(get("estimatedNumNeighborInteractions")),
+      get("avgParticlesPerCell"), get("particlesPerCellStdDev"), get("homogeneity"), get("maxDensity"),
+      std::log1p(get("threadCount"));
+  return features;
+}
+
+std::optional<Eigen::VectorXd> RegressionCostModel::encodeConfiguration(const Configuration &configuration) const {
+  const auto containerTraversalEstimator =
+      std::make_tuple(configuration.container, configuration.traversal, configuration.loadEstimator);
+  if (configuration.interactionType != _interactionType or
+      std::find(_containerTraversalEstimatorOptions.begin(), _containerTraversalEstimatorOptions.end(),
+                containerTraversalEstimator) == _containerTraversalEstimatorOptions.end()) {
+    return std::nullopt;
+  }
+  return _encoder.oneHotEncode(FeatureVector(configuration));
+}
+
+void RegressionCostModel::train(const Eigen::VectorXd &liveFeatures, const Configuration &configuration, long value) {
+  const auto oneHot = encodeConfiguration(configuration);
+  if (not oneHot.has_value() or value <= 0) {
+    return;
+  }
+  // Outer product of configuration and scenario features, flattened column-wise.
+  const Eigen::MatrixXd outer = *oneHot * liveFeatures.transpose();
+  const Eigen::VectorXd phi = Eigen::Map<const Eigen::VectorXd>(outer.data(), outer.size());
+
+  _gramMatrix.noalias() += phi * phi.transpose();
+  _rhs += std::log(static_cast<double>(value)) * phi;
+  _oneHotObservations += *oneHot;
+  ++_numTrainingSamples;
+  _weightsAreCurrent = false;
+}
+
+std::optional<double> RegressionCostModel::predict(const Eigen::VectorXd &liveFeatures,
+                                                   const Configuration &configuration) {
+  const auto oneHot = encodeConfiguration(configuration);
+  if (not oneHot.has_value()) {
+    return std::nullopt;
+  }
+  // Every active discrete option needs to be backed by training data. The last entry is the continuous cell size factor.
+  for (Eigen::Index i = 0; i < oneHot->size() - static_cast<Eigen::Index>(FeatureVectorEncoder::tunableContinuousDims);
+       ++i) {
+    if ((*oneHot)[i] != 0. and _oneHotObservations[i] == 0.) {
+      return std::nullopt;
+    }
+  }
+
+  if (not _weightsAreCurrent) {
+    const Eigen::MatrixXd regularizedGramMatrix =
+        _gramMatrix + regularization * Eigen::MatrixXd::Identity(_gramMatrix.rows(), _gramMatrix.cols());
+    _weights = regularizedGramMatrix.ldlt().solve(_rhs);
+    _weightsAreCurrent = true;
+  }
+
+  const Eigen::MatrixXd outer = *oneHot * liveFeatures.transpose();
+  const Eigen::VectorXd phi = Eigen::Map<const Eigen::VectorXd>(outer.data(), outer.size());
+  return std::exp(_weights.dot(phi));
+}
+
+}  // namespace autopas
@@ -0,0 +1,179 @@
+/**
+ * @file RegressionCostModel.h
+ * @date 18.10.26
+ */
+
+#pragma once
+
+#include <Eigen/Core>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "TuningStrategyInterface.h"
+#include "autopas/options/InteractionTypeOption.h"
+#include "autopas/tuning/Configuration.h"
+#include "autopas/tuning/utils/FeatureVector.h"
+#include "autopas/tuning/utils/FeatureVectorEncoder.h"
+
+namespace autopas {
+
+/**
+ * Regression model that predicts the runtime of a configuration in a scenario described by LiveInfo.
+ *
+ * The model is a ridge regression of the logarithm of the evidence on the outer product of the one-hot encoded
+ * configuration (see FeatureVectorEncoder) and a small set of scenario features taken from LiveInfo. This lets every
+ * option have its own scaling with e.g. the number of particles or the density, so what was learned in one scenario
+ * carries over to others. The encoding covers all options of the interaction type, hence models are comparable
+ * between runs with different search spaces.
+ *
+ * The normal equations are accumulated with every new piece of evidence and solved at the beginning of each tuning
+ * phase. Before the first phase, the model can be trained offline from a log written by TuningStrategyLogger.
+ *
+ * At the beginning of a tuning phase the queue is sorted so that the configuration with the best prediction is tested
+ * first. Configurations predicted to be slower than the best by more than the prune factor are removed. Configurations
+ * with options the model has never seen are never removed.
+ */
+class RegressionCostModel : public TuningStrategyInterface {
+ public:
+  /**
+   * Constructor.
+   * @param interactionType Interaction type of all configurations that are passed to this strategy.
+   * @param pruneFactor Configurations predicted to be slower than the best prediction times this factor are removed.
+   * @param trainingLogFileName Log of TuningStrategyLogger to train the model with. Ignored if empty.
+   */
+  RegressionCostModel(const InteractionTypeOption &interactionType, double pruneFactor,
+                      const std::string &trainingLogFileName);
+
+  TuningStrategyOption getOptionType() const override;
+
+  void addEvidence(const Configuration &configuration, const Evidence &evidence) override;
+
+  bool optimizeSuggestions(std::vector<Configuration> &configQueue,
+                           const EvidenceCollection &evidenceCollection) override;
+
+  bool reset(size_t iteration, size_t tuningPhase, std::vector<Configuration> &configQueue,
+             const EvidenceCollection &evidenceCollection) override;
+
+  [[nodiscard]] bool needsLiveInfo() const override;
+
+  void receiveLiveInfo(const LiveInfo &info) override;
+
+  /**
+   * Adds one training sample to the model.
+   * @param info Scenario the sample was measured in.
+   * @param configuration
+   * @param value Measured evidence value. Non positive values are ignored.
+   */
+  void train(const LiveInfo &info, const Configuration &configuration, long value);
+
+  /**
+   * Trains the model with all evidence of a log written by TuningStrategyLogger.
+   * Each evidence is paired with the last live info that was logged before it.
+   * @param fileName
+   * @return Number of training samples that were read.
+   */
+  size_t trainFromTuningLog(const std::string &fileName);
+
+  /**
+   * Predicts the evidence value of a configuration in the given scenario.
+   * @param info
+   * @param configuration
+   * @return The prediction or nothing if the configuration contains options the model was never trained with.
+   */
+  [[nodiscard]] std::optional<double> predict(const LiveInfo &info, const Configuration &configuration);
+
+  /**
+   * Getter for the number of samples the model was trained with.
+   * @return
+   */
+  [[nodiscard]] size_t getNumTrainingSamples() const;
+
+ private:
+  /**
+   * Extracts the scenario features from a LiveInfo. The first feature is a constant bias.
+   * @param info
+   * @return
+   */
+  static Eigen::VectorXd encodeLiveInfo(const LiveInfo &info);
+
+  /**
+   * One-hot encodes a configuration.
+   * @param configuration
+   * @return Nothing if the configuration can not be encoded.
+   */
+  [[nodiscard]] std::optional<Eigen::VectorXd> encodeConfiguration(const Configuration &configuration) const;
+
+  /**
+   * Adds one training sample given by its encoded parts.
+   * @param liveFeatures
+   * @param configuration
+   * @param value
+   */
+  void train(const Eigen::VectorXd &liveFeatures, const Configuration &configuration, long value);
+
+  /**
+   * Predicts the evidence value given the encoded scenario.
+   * @param liveFeatures
+   * @param configuration
+   * @return
+   */
+  [[nodiscard]] std::optional<double> predict(const Eigen::VectorXd &liveFeatures, const Configuration &configuration);
+
+  /**
+   * Interaction type of all configurations.
+   */
+  InteractionTypeOption _interactionType;
+
+  /**
+   * Configurations predicted to be slower than the best prediction times this factor are removed.
+   */
+  double _pruneFactor;
+
+  /**
+   * All combinations of container, traversal, and load estimator of the interaction type.
+   */
+  std::vector<FeatureVector::ContainerTraversalEstimatorOption> _containerTraversalEstimatorOptions{};
+
+  /**
+   * Encoder for all options of the interaction type.
+   */
+  FeatureVectorEncoder _encoder;
+
+  /**
+   * Accumulated Phi^T * Phi of all training samples.
+   */
+  Eigen::MatrixXd _gramMatrix;
+
+  /**
+   * Accumulated Phi^T * y of all training samples.
+   */
+  Eigen::VectorXd _rhs;
+
+  /**
+   * Solution of the regularized normal equations.
+   */
+  Eigen::VectorXd _weights;
+
+  /**
+   * Whether _weights reflects all training samples.
+   */
+  bool _weightsAreCurrent{false};
+
+  /**
+   * How often each entry of the one-hot encoding was active in the training samples.
+   */
+  Eigen::VectorXd _oneHotObservations;
+
+  /**
+   * Number of samples the model was trained with.
+   */
+  size_t _numTrainingSamples{0};
+
+  /**
+   * Scenario features of the current tuning phase.
+   */
+  std::optional<Eigen::VectorXd> _currentLiveFeatures{};
+};
+
+}  // namespace autopas
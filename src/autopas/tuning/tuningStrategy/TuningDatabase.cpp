@@ -0,0 +1,208 @@
+/**
+ * @file TuningDatabase.cpp
+ * @date 18.10.26
+ */
+
+#include "TuningDatabase.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+#include "autopas/utils/WrapMPI.h"
+#include "autopas/utils/logging/Logger.h"
+
+namespace autopas {
+
+TuningDatabase::Fingerprint TuningDatabase::Fingerprint::fromLiveInfo(const LiveInfo &liveInfo) {
+  const auto &infos = liveInfo.get();
+  // helper to read an info of a given type with a fallback if it was not gathered
+  const auto getOr = [&](const std::string &name, auto fallback) {
+    const auto iter = infos.find(name);
+    if (iter == infos.end()) {
+      return fallback;
+    }
+    return std::get<decltype(fallback)>(iter->second);
+  };
+  return {getOr("maxDensity", 0.), getOr("homogeneity", 0.), getOr("particleSize", size_t{0}),
+          getOr("threadCount", size_t{0}), getOr("functorTypeHash", size_t{0})};
+}
+
+double TuningDatabase::Fingerprint::distance(const Fingerprint &other) const {
+  if (particleSize != other.particleSize or threadCount != other.threadCount or
+      functorTypeHash != other.functorTypeHash) {
+    return std::numeric_limits<double>::infinity();
+  }
+  const auto relativeDifference = [](double a, double b) {
+    const auto scale = std::max({std::abs(a), std::abs(b), std::numeric_limits<double>::epsilon()});
+    return std::abs(a - b) / scale;
+  };
+  return std::max(relativeDifference(maxDensity, other.maxDensity), relativeDifference(homogeneity, other.homogeneity));
+}
+
+TuningDatabase::TuningDatabase(std::string databaseFileName, double warmStartDistance, double skipDistance)
+    : _databaseFileName(std::move(databaseFileName)),
+      _warmStartDistance(warmStartDistance),
+      _skipDistance(skipDistance) {
+  int rank{0};
+  AutoPas_MPI_Comm_rank(AUTOPAS_MPI_COMM_WORLD, &rank);
+  _writesDatabaseFile = rank == 0;
+
+  std::ifstream in{_databaseFileName};
+  // a missing database is fine, it will be created at the end of the first tuning phase
+  if (not in.is_open()) {
+    AutoPasLog(DEBUG, "TuningDatabase: No database found at {}. Starting with an empty one.", _databaseFileName);
+    return;
+  }
+  std::string line;
+  while (std::getline(in, line)) {
+    if (line.empty()) {
+      continue;
+    }
+    std::stringstream lineStream{line};
+    Entry entry;
+    size_t numConfigurations{0};
+    lineStream >> entry.fingerprint.maxDensity >> entry.fingerprint.homogeneity >> entry.fingerprint.particleSize >>
+        entry.fingerprint.threadCount >> entry.fingerprint.functorTypeHash >> numConfigurations;
+    for (size_t i = 0; i < numConfigurations and lineStream; ++i) {
+      long value{0};
+      Configuration configuration;
+      lineStream >> value >> configuration;
+      entry.rankedConfigurations.emplace_back(configuration, value);
+    }
+    if (lineStream.fail() or entry.rankedConfigurations.size() != numConfigurations) {
+      AutoPasLog(WARN, "TuningDatabase: Skipping malformed entry in {}: {}", _databaseFileName, line);
+      continue;
+    }
+    _entries.push_back(std::move(entry));
+  }
+  AutoPasLog(DEBUG, "TuningDatabase: Loaded {} entries from {}.", _entries.size(), _databaseFileName);
+}
+
+TuningDatabase::~TuningDatabase() = default;
+
+TuningStrategyOption TuningDatabase::getOptionType() const { return TuningStrategyOption::tuningDatabase; }
+
+void TuningDatabase::addEvidence(const Configuration &configuration, const Evidence &evidence) {
+  _currentPhaseEvidence[configuration] = evidence.value;
+}
+
+bool TuningDatabase::optimizeSuggestions(std::vector<Configuration> &configQueue,
+                                         const EvidenceCollection & /*evidenceCollection*/) {
+  // The order is only seeded at the beginning of a tuning phase. An empty queue means the tuning phase is complete.
+  if (configQueue.empty()) {
+    persistCurrentPhase();
+  }
+  return false;
+}
+
+bool TuningDatabase::reset(size_t /*iteration*/, size_t /*tuningPhase*/, std::vector<Configuration> &configQueue,
+                           const EvidenceCollection & /*evidenceCollection*/) {
+  // A new tuning phase only starts after the previous one is complete. This catches phases that were ended by a
+  // strategy applied after this one.
+  persistCurrentPhase();
+
+  if (not _currentFingerprint.has_value()) {
+    return false;
+  }
+  const auto [closestEntry, distance] = findClosestEntry(*_currentFingerprint);
+  if (closestEntry == nullptr or distance > _warmStartDistance) {
+    return false;
+  }
+
+  // Collect all known configurations that are also still in the queue, best first.
+  std::vector<Configuration> knownConfigurations;
+  for (const auto &[configuration, value] : closestEntry->rankedConfigurations) {
+    if (std::find(configQueue.begin(), configQueue.end(), configuration) != configQueue.end()) {
+      knownConfigurations.push_back(configuration);
+    }
+  }
+  if (knownConfigurations.empty()) {
+    return false;
+  }
+
+  if (distance <= _skipDistance) {
+    AutoPasLog(DEBUG, "TuningDatabase: Close match (distance {}). Skipping tuning in favor of {}.", distance,
+               knownConfigurations.front().toShortString());
+    configQueue = {knownConfigurations.front()};
+    _currentPhaseSkipped = true;
+    return false;
+  }
+
+  AutoPasLog(DEBUG, "TuningDatabase: Similar scenario found (distance {}). Testing {} known configurations first.",
+             distance, knownConfigurations.size());
+  // The queue is processed from the back, so remove the known configurations and append them in reverse order.
+  configQueue.erase(std::remove_if(configQueue.begin(), configQueue.end(),
+                                   [&](const auto &configuration) {
+                                     return std::find(knownConfigurations.begin(), knownConfigurations.end(),
+                                                      configuration) != knownConfigurations.end();
+                                   }),
+                    configQueue.end());
+  configQueue.insert(configQueue.end(), knownConfigurations.rbegin(), knownConfigurations.rend());
+  return false;
+}
+
+bool TuningDatabase::needsLiveInfo() const { return true; }
+
+void TuningDatabase::receiveLiveInfo(const LiveInfo &info) {
+  // Live info is only gathered at the start of a tuning phase before reset() is called, so the previous phase is
+  // complete. Store what was learned with the previous fingerprint first.
+  persistCurrentPhase();
+  _currentFingerprint = Fingerprint::fromLiveInfo(info);
+}
+
+void TuningDatabase::rejectConfiguration(const Configuration &configuration, bool /*indefinitely*/) {
+  _currentPhaseEvidence.erase(configuration);
+}
+
+const std::vector<TuningDatabase::Entry> &TuningDatabase::getEntries() const { return _entries; }
+
+std::pair<const TuningDatabase::Entry *, double> TuningDatabase::findClosestEntry(
+    const Fingerprint &fingerprint) const {
+  const Entry *closestEntry = nullptr;
+  double closestDistance = std::numeric_limits<double>::infinity();
+  for (const auto &entry : _entries) {
+    const auto distance = fingerprint.distance(entry.fingerprint);
+    // prefer newer entries if the distance is the same
+    if (distance <= closestDistance and not std::isinf(distance)) {
+      closestEntry = &entry;
+      closestDistance = distance;
+    }
+  }
+  return {closestEntry, closestDistance};
+}
+
+void TuningDatabase::persistCurrentPhase() {
+  const bool hasNewKnowledge =
+      _currentFingerprint.has_value() and not _currentPhaseEvidence.empty() and not _currentPhaseSkipped;
+  if (hasNewKnowledge) {
+    Entry entry{*_currentFingerprint, {_currentPhaseEvidence.begin(), _currentPhaseEvidence.end()}};
+    std::sort(entry.rankedConfigurations.begin(), entry.rankedConfigurations.end(),
+              [](const auto &lhs, const auto &rhs) { return lhs.second < rhs.second; });
+
+    std::ofstream out;
+    if (_writesDatabaseFile) {
+      out.open(_databaseFileName, std::ios::app);
+    }
+    if (out.is_open()) {
+      // full precision so that fingerprints survive the round trip
+      out.precision(std::numeric_limits<double>::max_digits10);
+      const auto &fp = entry.fingerprint;
+      out << fp.maxDensity << ' ' << fp.homogeneity << ' ' << fp.particleSize << ' ' << fp.threadCount << ' '
+          << fp.functorTypeHash << ' ' << entry.rankedConfigurations.size();
+      for (const auto &[configuration, value] : entry.rankedConfigurations) {
+        out << ' ' << value << ' ' << configuration;
+      }
+      out << std::endl;
+    } else if (_writesDatabaseFile) {
+      AutoPasLog(WARN, "TuningDatabase: Could not open {} for writing.", _databaseFileName);
+    }
+    _entries.push_back(std::move(entry));
+  }
+  _currentPhaseEvidence.clear();
+  _currentPhaseSkipped = false;
+}
+
+}  // namespace autopas
@@ -0,0 +1,183 @@
+/**
+ * @file TuningDatabase.h
+ * @date 18.10.26
+ */
+
+#pragma once
+
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "TuningStrategyInterface.h"
+#include "autopas/tuning/Configuration.h"
+
+namespace autopas {
+
+/**
+ * Persistent knowledge base of tuning results that is shared between runs.
+ *
+ * At the end of every tuning phase, the evidence of all tested configurations is appended to a file together with a
+ * fingerprint of the scenario it was collected in. At the start of a tuning phase, the entry whose fingerprint is most
+ * similar to the current LiveInfo is looked up:
+ *  - If the distance is below the warm start distance, the configurations of that entry are moved to the front of the
+ *    queue, best first.
+ *  - If the distance is below the skip distance, the queue is reduced to the best known configuration, which
+ *    effectively skips the tuning phase.
+ *
+ * Only entries with the same functor, thread count and particle size are considered. The distance is the maximal
+ * relative difference in maxDensity and homogeneity.
+ *
+ * Only completed tuning phases are persisted. With MPI, every rank keeps its results in memory but only rank 0 appends
+ * them to the file.
+ */
+class TuningDatabase : public TuningStrategyInterface {
+ public:
+  /**
+   * Features that identify a scenario.
+   */
+  struct Fingerprint {
+    /**
+     * Maximal density of the particles in the domain.
+     */
+    double maxDensity{0.};
+    /**
+     * Homogeneity of the particle distribution.
+     */
+    double homogeneity{0.};
+    /**
+     * Size of one particle in bytes.
+     */
+    size_t particleSize{0};
+    /**
+     * Number of threads that were available.
+     */
+    size_t threadCount{0};
+    /**
+     * Hash of the functor type.
+     */
+    size_t functorTypeHash{0};
+
+    /**
+     * Creates a fingerprint from the relevant live infos.
+     * @param liveInfo
+     * @return
+     */
+    static Fingerprint fromLiveInfo(const LiveInfo &liveInfo);
+
+    /**
+     * Distance between two fingerprints.
+     * @param other
+     * @return Infinity if the discrete features differ, otherwise the maximal relative difference of the continuous
+     * features.
+     */
+    [[nodiscard]] double distance(const Fingerprint &other) const;
+  };
+
+  /**
+   * One record of the database.
+   */
+  struct Entry {
+    /**
+     * Scenario the evidence was collected in.
+     */
+    Fingerprint fingerprint{};
+    /**
+     * Configurations and their evidence values, sorted ascending by value (best first).
+     */
+    std::vector<std::pair<Configuration, long>> rankedConfigurations{};
+  };
+
+  /**
+   * Constructor. Reads all existing entries from the given file.
+   * @param databaseFileName Path of the database file. It is created if it does not exist.
+   * @param warmStartDistance Maximal fingerprint distance for the historically best configurations to be tested first.
+   * @param skipDistance Maximal fingerprint distance for the tuning phase to be skipped.
+   */
+  TuningDatabase(std::string databaseFileName, double warmStartDistance, double skipDistance);
+
+  /**
+   * Destructor. Results of an unfinished tuning phase are discarded.
+   */
+  ~TuningDatabase() override;
+
+  TuningStrategyOption getOptionType() const override;
+
+  void addEvidence(const Configuration &configuration, const Evidence &evidence) override;
+
+  bool optimizeSuggestions(std::vector<Configuration> &configQueue,
+                           const EvidenceCollection &evidenceCollection) override;
+
+  bool reset(size_t iteration, size_t tuningPhase, std::vector<Configuration> &configQueue,
+             const EvidenceCollection &evidenceCollection) override;
+
+  [[nodiscard]] bool needsLiveInfo() const override;
+
+  void receiveLiveInfo(const LiveInfo &info) override;
+
+  void rejectConfiguration(const Configuration &configuration, bool indefinitely) override;
+
+  /**
+   * Getter for all entries that are currently known.
+   * @return
+   */
+  [[nodiscard]] const std::vector<Entry> &getEntries() const;
+
+ private:
+  /**
+   * Finds the entry that is most similar to the given fingerprint.
+   * @param fingerprint
+   * @return Pointer to the entry and its distance or nullptr if nothing comparable is stored.
+   */
+  [[nodiscard]] std::pair<const Entry *, double> findClosestEntry(const Fingerprint &fingerprint) const;
+
+  /**
+   * Appends the evidence of the current tuning phase to the database file and the in memory entries.
+   * Must only be called once the tuning phase is complete.
+   */
+  void persistCurrentPhase();
+
+  /**
+   * Path of the database file.
+   */
+  std::string _databaseFileName;
+
+  /**
+   * Maximal fingerprint distance for a warm start.
+   */
+  double _warmStartDistance;
+
+  /**
+   * Maximal fingerprint distance to skip tuning.
+   */
+  double _skipDistance;
+
+  /**
+   * All known entries.
+   */
+  std::vector<Entry> _entries{};
+
+  /**
+   * Fingerprint of the current tuning phase.
+   */
+  std::optional<Fingerprint> _currentFingerprint{};
+
+  /**
+   * Evidence collected in the current tuning phase.
+   */
+  std::map<Configuration, long> _currentPhaseEvidence{};
+
+  /**
+   * Whether the current tuning phase was skipped based on the database. Such phases are not persisted because they
+   * would only duplicate what is already known.
+   */
+  bool _currentPhaseSkipped{false};
+
+  /**
+   * Whether this rank appends to the database file. Only rank 0 does so that ranks do not write the same file.
+   */
+  bool _writesDatabaseFile{true};
+};
+
+}  // namespace autopas
@@ -13,8 +13,10 @@
 #include "autopas/tuning/tuningStrategy/MPIParallelizedStrategy.h"
 #include "autopas/tuning/tuningStrategy/PredictiveTuning.h"
 #include "autopas/tuning/tuningStrategy/RandomSearch.h"
+#include "autopas/tuning/tuningStrategy/RegressionCostModel.h"
 #include "autopas/tuning/tuningStrategy/SlowConfigFilter.h"
 #include "autopas/tuning/tuningStrategy/SortByName.h"
+#include "autopas/tuning/tuningStrategy/TuningDatabase.h"
 #include "autopas/tuning/tuningStrategy/TuningStrategyFactoryInfo.h"
 #include "autopas/tuning/tuningStrategy/fuzzyTuning/FuzzyTuning.h"
 #include "autopas/tuning/tuningStrategy/ruleBasedTuning/RuleBasedTuning.h"
@@ -123,7 +125,8 @@ std::unique_ptr<TuningStrategyInterface> generateTuningStrategy(const std::set<C
       }
       tuningStrategy = std::make_unique<MPIParallelizedStrategy>(
           MPIParallelizedStrategy::createFallBackConfiguration(searchSpace, info.interactionType),
-          info.autopasMpiCommunicator, info.mpiTuningMaxDifferenceForBucket, info.mpiTuningWeightForMaxDensity);
+          info.autopasMpiCommunicator, info.mpiTuningMaxDifferenceForBucket, info.mpiTuningWeightForMaxDensity,
+          info.mpiTuningShareEvidence);
       break;
     }
 
@@ -137,6 +140,18 @@ std::unique_ptr<TuningStrategyInterface> generateTuningStrategy(const std::set<C
       break;
     }
 
+    case TuningStrategyOption::tuningDatabase: {
+      tuningStrategy = std::make_unique<TuningDatabase>(
+          info.tuningDatabaseFileName, info.tuningDatabaseWarmStartDistance, info.tuningDatabaseSkipDistance);
+      break;
+    }
+
+    case TuningStrategyOption::regressionCostModel: {
+      tuningStrategy = std::make_unique<RegressionCostModel>(info.interactionType, info.regressionCostModelPruneFactor,
+                                                             info.regressionCostModelTrainingLog);
+      break;
+    }
+
     default: {
       utils::ExceptionHandler::exception("AutoPas::generateTuningStrategy: Unknown tuning strategy {}!",
                                          tuningStrategyOption);
@@ -71,6 +71,31 @@ struct TuningStrategyFactoryInfo {
    */
   std::string fuzzyRuleFileName{"fuzzyRulesSuitability.frule"};
 
+  // Tuning Database Options
+  /**
+   * The name and path of the file where tuning results are stored across runs.
+   */
+  std::string tuningDatabaseFileName{"tuningDatabase.txt"};
+  /**
+   * Maximal distance between the current and a stored scenario for the stored best configurations to be tested first.
+   */
+  double tuningDatabaseWarmStartDistance{0.3};
+  /**
+   * Maximal distance between the current and a stored scenario for the tuning phase to be skipped.
+   */
+  double tuningDatabaseSkipDistance{0.05};
+
+  // Regression Cost Model Options
+  /**
+   * Log of TuningStrategyLogger the regression cost model is trained with before the first tuning phase.
+   * No offline training if empty.
+   */
+  std::string regressionCostModelTrainingLog{};
+  /**
+   * Configurations predicted to be slower than the best prediction times this factor are not tested.
+   */
+  double regressionCostModelPruneFactor{3.};
+
   // MPI Tuning Options
   /**
    * If MPIParallelizedStrategy is in the list of strategies this should be set to true to notify other strategies
@@ -85,6 +110,10 @@ struct TuningStrategyFactoryInfo {
    * Weight for maxDensity in the calculation for bucket distribution.
    */
   double mpiTuningWeightForMaxDensity{0.0};
+  /**
+   * Whether the ranks of a bucket exchange their evidence and agree on a shared optimum.
+   */
+  bool mpiTuningShareEvidence{false};
   /**
    * MPI Communicator used within AutoPas.
    */
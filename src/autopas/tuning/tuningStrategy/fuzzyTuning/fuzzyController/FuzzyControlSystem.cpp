@@ -6,9 +6,12 @@
 
 #include "FuzzyControlSystem.h"
 
+#include <algorithm>
+#include <limits>
 #include <numeric>
 
 #include "autopas/utils/ExceptionHandler.h"
+#include "autopas/utils/Math.h"
 
 namespace autopas::FuzzyLogic {
 
@@ -28,6 +31,8 @@ void FuzzyControlSystem::addRule(const FuzzyRule &rule) {
   }
 
   _rules.push_back(rule);
+  // invalidate the sampled consequents
+  _numCompiledSamples = 0;
 };
 
 std::shared_ptr<FuzzySet> FuzzyControlSystem::applyRules(const FuzzySet::Data &data) const {
@@ -38,7 +43,9 @@ std::shared_ptr<FuzzySet> FuzzyControlSystem::applyRules(const FuzzySet::Data &d
 }
 
 double FuzzyControlSystem::predict(const FuzzySet::Data &data, size_t numSamples) const {
-  auto unionSet = applyRules(data);
+  if (_rules.empty()) {
+    autopas::utils::ExceptionHandler::exception("FuzzyControlSystem: Cannot predict without rules");
+  }
 
   if (_settings->count("defuzzificationMethod") == 0) {
     autopas::utils::ExceptionHandler::exception("No defuzzification method specified in the settings");
@@ -52,7 +59,75 @@ double FuzzyControlSystem::predict(const FuzzySet::Data &data, size_t numSamples
 
   AutoPasLog(DEBUG, "Defuzzifying with method: {} and numSamples: {}", defuzzificationMethod.to_string(), numSamples);
 
-  return unionSet->defuzzify(defuzzificationMethod, numSamples);
+  if (numSamples != _numCompiledSamples) {
+    compileRules(numSamples);
+  }
+
+  // Cut the sampled consequents by how much their antecedents are fulfilled and unite them (Fuzzy-OR).
+  const auto numSamplePoints = _samplePoints.size();
+  std::vector<double> unionMemberships(numSamplePoints, std::numeric_limits<double>::lowest());
+  for (size_t ruleIndex = 0; ruleIndex < _rules.size(); ++ruleIndex) {
+    const double cut = _rules[ruleIndex].getAntecedent()->evaluate_membership(data);
+    const auto *consequentMemberships = &_sampledConsequents[ruleIndex * numSamplePoints];
+    for (size_t i = 0; i < numSamplePoints; ++i) {
+      unionMemberships[i] = std::max(unionMemberships[i], std::min(cut, consequentMemberships[i]));
+    }
+  }
+
+  // Defuzzify the sampled union set. This is equivalent to FuzzySet::defuzzify() of the union set.
+  switch (defuzzificationMethod) {
+    case DefuzzificationMethodOption::CoG: {
+      // centroid_x = sum(x*y) / sum(y)
+      double numerator = 0;
+      double denominator = 0;
+      for (size_t i = 0; i < numSamplePoints; ++i) {
+        numerator += _samplePoints[i] * unionMemberships[i];
+        denominator += unionMemberships[i];
+      }
+      return denominator == 0 ? 0 : numerator / denominator;
+    }
+    case DefuzzificationMethodOption::MoM: {
+      double maxMembershipValue = 0;
+      std::vector<double> maxMembershipXs;
+      for (size_t i = 0; i < numSamplePoints; ++i) {
+        if (unionMemberships[i] > maxMembershipValue) {
+          maxMembershipValue = unionMemberships[i];
+          maxMembershipXs.clear();
+        }
+        if (utils::Math::isNearRel(unionMemberships[i], maxMembershipValue, 1e-5)) {
+          maxMembershipXs.push_back(_samplePoints[i]);
+        }
+      }
+      return maxMembershipXs.empty() ? 0
+                                     : std::accumulate(maxMembershipXs.begin(), maxMembershipXs.end(), 0.0) /
+                                           static_cast<double>(maxMembershipXs.size());
+    }
+    default:
+      throw autopas::utils::ExceptionHandler::AutoPasException("Unknown defuzzification method");
+  }
+}
+
+void FuzzyControlSystem::compileRules(size_t numSamples) const {
+  // The union of all consequents is defined over the crisp set of the first consequent.
+  const auto [dimensionName, range] = *_rules.front().getConsequent()->getCrispSet()->getDimensions().begin();
+  const auto [minBoundary, maxBoundary] = range;
+
+  // Use the same sample points as FuzzySet::defuzzify().
+  _samplePoints.clear();
+  for (double x = minBoundary; x <= maxBoundary; x += (maxBoundary - minBoundary) / (numSamples - 1)) {
+    _samplePoints.push_back(x);
+  }
+
+  _sampledConsequents.clear();
+  _sampledConsequents.reserve(_rules.size() * _samplePoints.size());
+  std::map<std::string, double> data = {{dimensionName, 0.0}};
+  for (const auto &rule : _rules) {
+    for (const auto x : _samplePoints) {
+      data[dimensionName] = x;
+      _sampledConsequents.push_back(rule.getConsequent()->evaluate_membership(data));
+    }
+  }
+  _numCompiledSamples = numSamples;
 }
 
 FuzzyControlSystem::operator std::string() const {
@@ -61,6 +61,10 @@ class FuzzyControlSystem {
    *
    * The method reads the "defuzzificationMethod" and "numSamples" settings from the provided settings and performs the
    * defuzzification accordingly.
+   *
+   * The consequents do not depend on the data, so they are only sampled once per number of samples. Afterward, a
+   * prediction only evaluates the antecedents and combines them with the cached samples. The result is identical to
+   * defuzzifying the FuzzySet returned by applyRules().
    */
   [[nodiscard]] double predict(const FuzzySet::Data &data, size_t numSamples = 1000) const;
 
@@ -84,6 +88,27 @@ class FuzzyControlSystem {
    * The output domain of the FuzzyControlSystem.
    */
   std::optional<std::string> _outputDomain;
+
+  /**
+   * Samples the consequents of all rules over the output domain.
+   * @param numSamples The number of samples to use for the numerical defuzzification.
+   */
+  void compileRules(size_t numSamples) const;
+
+  /**
+   * Number of samples the cached consequents were sampled with. Zero if nothing is cached.
+   */
+  mutable size_t _numCompiledSamples{0};
+
+  /**
+   * Positions in the output domain at which the consequents are sampled.
+   */
+  mutable std::vector<double> _samplePoints;
+
+  /**
+   * Membership values of the consequents at all sample points. One row of _samplePoints.size() values per rule.
+   */
+  mutable std::vector<double> _sampledConsequents;
 };
 
 }  // namespace autopas::FuzzyLogic
\ No newline at end of file
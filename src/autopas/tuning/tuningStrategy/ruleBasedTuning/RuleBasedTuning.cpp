@@ -23,6 +23,9 @@ RuleBasedTuning::RuleBasedTuning(const std::set<Configuration> &searchSpace, boo
   if (stat(_ruleFileName.c_str(), &buffer) != 0) {
     utils::ExceptionHandler::exception("Rule file {} does not exist!", _ruleFileName);
   }
+  for (const auto &configuration : _originalSearchSpace) {
+    _searchSpaceIndices.emplace(configuration, _searchSpaceIndices.size());
+  }
   // By default, dump the rules for reproducibility reasons.
   int myRank{};
   AutoPas_MPI_Comm_rank(AUTOPAS_MPI_COMM_WORLD, &myRank);
@@ -161,39 +164,39 @@ void RuleBasedTuning::verifyCurrentConfigTime(const Configuration &configuration
 std::vector<RuleSyntax::ConfigurationOrder> RuleBasedTuning::applyRules(const std::vector<Configuration> &searchSpace) {
   AutoPasLog(DEBUG, _currentLiveInfo.toString());
 
+  compileRules();
+
+  // The live info is accessed via the global variables at the bottom of the stack.
   std::vector<RuleVM::MemoryCell> initialStack;
-  std::vector<std::pair<std::string, RuleSyntax::Define>> defines{};
+  initialStack.reserve(_currentLiveInfo.get().size());
   for (const auto &[name, value] : _currentLiveInfo.get()) {
     initialStack.emplace_back(value);
-    defines.push_back({name, {name, std::make_shared<RuleSyntax::Literal>(value)}});
   }
-
-  std::ifstream ifs{_ruleFileName};
-  const std::string content((std::istreambuf_iterator<char>(ifs)), (std::istreambuf_iterator<char>()));
-
-  RuleSyntax::RuleBasedProgramParser parser{defines};
-  auto [programTree, context] = parser.parse(content);
-
-  const auto generatedProgram = programTree.generateCode(context);
-
-  RuleVM vm{};
-  const auto removePatterns = vm.execute(generatedProgram, initialStack);
+  const auto removePatterns = _vm.execute(_compiledProgram, initialStack);
 
   AutoPasLog(DEBUG, "Remove patterns (Count {}):", removePatterns.size());
-  std::vector<ConfigurationPattern> toRemovePatterns{};
+  std::vector<bool> removedConfigurations(_searchSpaceIndices.size(), false);
   std::vector<RuleSyntax::ConfigurationOrder> applicableConfigurationOrders{};
   for (const auto &patternIdx : removePatterns) {
-    const auto pattern = context.smallerConfigurationPatternByIndex(patternIdx);
-    toRemovePatterns.push_back(pattern);
-    AutoPasLog(DEBUG, "Remove {}", pattern.toString());
+    const auto &order = _compiledConfigurationOrders[patternIdx];
+    AutoPasLog(DEBUG, "Remove {}", order.smaller.toString());
+    applicableConfigurationOrders.push_back(order);
 
-    applicableConfigurationOrders.push_back(context.getConfigurationOrders().at(patternIdx));
+    const auto &removalMask = _removalMasks[patternIdx];
+    for (size_t i = 0; i < removedConfigurations.size(); ++i) {
+      removedConfigurations[i] = removedConfigurations[i] or removalMask[i];
+    }
   }
 
   std::list<Configuration> newSearchSpace{searchSpace.begin(), searchSpace.end()};
   newSearchSpace.remove_if([&](const Configuration &configuration) {
-    const bool remove = std::any_of(toRemovePatterns.begin(), toRemovePatterns.end(),
-                                    [&configuration](const auto &pattern) { return pattern.matches(configuration); });
+    const auto indexIter = _searchSpaceIndices.find(configuration);
+    // Configurations that are not part of the original search space have no precomputed matches.
+    const bool remove =
+        indexIter != _searchSpaceIndices.end()
+            ? removedConfigurations[indexIter->second]
+            : std::any_of(applicableConfigurationOrders.begin(), applicableConfigurationOrders.end(),
+                          [&configuration](const auto &order) { return order.smaller.matches(configuration); });
     if (remove) {
       _removedConfigurations.insert(configuration);
     }
@@ -210,6 +213,43 @@ std::vector<RuleSyntax::ConfigurationOrder> RuleBasedTuning::applyRules(const st
   return applicableConfigurationOrders;
 }
 
+void RuleBasedTuning::compileRules() {
+  // The program only refers to the live info by name and type, so it stays valid as long as these don't change.
+  std::vector<std::pair<std::string, size_t>> liveInfoSignature;
+  std::vector<std::pair<std::string, RuleSyntax::Define>> defines{};
+  for (const auto &[name, value] : _currentLiveInfo.get()) {
+    liveInfoSignature.emplace_back(name, value.index());
+    defines.push_back({name, {name, std::make_shared<RuleSyntax::Literal>(value)}});
+  }
+  if (not _compiledProgram.instructions.empty() and liveInfoSignature == _compiledLiveInfoSignature) {
+    return;
+  }
+
+  std::ifstream ifs{_ruleFileName};
+  const std::string content((std::istreambuf_iterator<char>(ifs)), (std::istreambuf_iterator<char>()));
+
+  RuleSyntax::RuleBasedProgramParser parser{defines};
+  auto [programTree, context] = parser.parse(content);
+
+  _compiledProgram = programTree.generateCode(context);
+  _compiledConfigurationOrders = context.getConfigurationOrders();
+  _compiledLiveInfoSignature = std::move(liveInfoSignature);
+
+  // Match every pattern against the search space once, so applying the rules later only combines these masks.
+  _removalMasks.clear();
+  _removalMasks.reserve(_compiledConfigurationOrders.size());
+  for (const auto &order : _compiledConfigurationOrders) {
+    std::vector<bool> removalMask(_searchSpaceIndices.size(), false);
+    for (const auto &[configuration, index] : _searchSpaceIndices) {
+      removalMask[index] = order.smaller.matches(configuration);
+    }
+    _removalMasks.push_back(std::move(removalMask));
+  }
+
+  AutoPasLog(DEBUG, "Compiled rule file {} to {} instructions and {} configuration orders.", _ruleFileName,
+             _compiledProgram.instructions.size(), _compiledConfigurationOrders.size());
+}
+
 #endif
 
 }  // namespace autopas
@@ -34,7 +34,10 @@ namespace autopas {
  *
  * This "knowledge" is encoded as rules in a rule file. The rules are defined by the user in a domain specific language,
  * formally described in RuleLanguage.g4, which is parsed by the RuleBasedProgramParser with the help of antlr4.
- * The rules are dynamically loaded and executed as a program for the RuleVM in the beginning of each tuning phase.
+ * The rules are dynamically loaded and compiled to a program for the RuleVM, which is executed in the beginning of each
+ * tuning phase. The program only depends on the names and types of the live info, so it is only recompiled if these
+ * change. The patterns of all configuration orders are evaluated for the whole search space during compilation, so
+ * removing configurations from the queue is a lookup.
  *
  *
  * <b>Summary of the Rule Language:</b>
@@ -158,6 +161,12 @@ class RuleBasedTuning : public TuningStrategyInterface {
    */
   std::vector<RuleSyntax::ConfigurationOrder> applyRules(const std::vector<Configuration> &searchSpace);
 
+  /**
+   * Parses the rule file and compiles it for the current live info if this was not already done for live info with the
+   * same names and types.
+   */
+  void compileRules();
+
   std::vector<RuleSyntax::ConfigurationOrder> _lastApplicableConfigurationOrders{};
 
   // The following member variables are only conditionally compiled to avoid warnings about unused variables.
@@ -174,6 +183,32 @@ class RuleBasedTuning : public TuningStrategyInterface {
    */
   bool _rulesTooHarsh{false};
   PrintTuningErrorFunType _tuningErrorPrinter{};
+
+  /**
+   * Names and variant indices of the live info the rules were compiled for.
+   */
+  std::vector<std::pair<std::string, size_t>> _compiledLiveInfoSignature{};
+  /**
+   * The compiled rule program. Empty if the rules were not compiled yet.
+   */
+  RuleVM::Program _compiledProgram{};
+  /**
+   * All configuration orders of the compiled program. The program outputs indices into this vector.
+   */
+  std::vector<RuleSyntax::ConfigurationOrder> _compiledConfigurationOrders{};
+  /**
+   * For every compiled configuration order, which configurations of the original search space match its smaller
+   * pattern. Indexed via _searchSpaceIndices.
+   */
+  std::vector<std::vector<bool>> _removalMasks{};
+  /**
+   * Position of every configuration of the original search space in the removal masks.
+   */
+  std::unordered_map<Configuration, size_t, ConfigHash> _searchSpaceIndices{};
+  /**
+   * The VM executing the compiled program. Kept to reuse its stack between tuning phases.
+   */
+  RuleVM _vm{};
 #endif
 
   std::set<Configuration> _searchSpace{};
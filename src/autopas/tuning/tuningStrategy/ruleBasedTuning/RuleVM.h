@@ -158,23 +158,28 @@ class RuleVM {
     _halt = false;
 
     while (not _halt) {
-      executeInstruction(program.instructions.at(_programCounter++));
+      executeInstruction(program.instructions[_programCounter++]);
     }
 
     return _removedPatterns;
   }
 
  private:
-  void executeInstruction(Instruction instruction) {
+  /**
+   * Executes a single instruction. Programs are generated by RuleBasedProgramTree, which reserves enough stack for
+   * all instructions, so stack accesses are not bounds checked.
+   * @param instruction
+   */
+  void executeInstruction(const Instruction &instruction) {
     switch (instruction.cmd) {
       case LOADC:
-        _stack.at(++_stackPointer) = instruction.payload;
+        _stack[++_stackPointer] = instruction.payload;
         break;
       case LOADA:
-        _stack.at(++_stackPointer) = _stack.at(std::get<size_t>(instruction.payload));
+        _stack[++_stackPointer] = _stack[std::get<size_t>(instruction.payload)];
         break;
       case STOREA:
-        _stack.at(std::get<size_t>(instruction.payload)) = _stack.at(_stackPointer--);
+        _stack[std::get<size_t>(instruction.payload)] = _stack[_stackPointer--];
         break;
       case RESERVE:
         _stackPointer += std::get<size_t>(instruction.payload);
@@ -182,23 +187,23 @@ class RuleVM {
       case LESS: {
         bool res = compare<std::less>();
         _stackPointer--;
-        _stack.at(_stackPointer) = res;
+        _stack[_stackPointer] = res;
         break;
       }
       case GREATER: {
         bool res = compare<std::greater>();
         _stackPointer--;
-        _stack.at(_stackPointer) = res;
+        _stack[_stackPointer] = res;
         break;
       }
       case EQUAL: {
         bool res = compare<std::equal_to>();
         _stackPointer--;
-        _stack.at(_stackPointer) = res;
+        _stack[_stackPointer] = res;
         break;
       }
       case JUMPZERO: {
-        bool shouldJump = not std::get<bool>(_stack.at(_stackPointer--));
+        bool shouldJump = not std::get<bool>(_stack[_stackPointer--]);
         if (shouldJump) {
           _programCounter = std::get<size_t>(instruction.payload);
         }
@@ -208,7 +213,7 @@ class RuleVM {
         _removedPatterns.push_back(std::get<size_t>(instruction.payload));
         break;
       case CONDOUTPUTC:
-        if (std::get<bool>(_stack.at(_stackPointer))) {
+        if (std::get<bool>(_stack[_stackPointer])) {
           _removedPatterns.push_back(std::get<size_t>(instruction.payload));
         }
         break;
@@ -216,13 +221,13 @@ class RuleVM {
         _halt = true;
         break;
       case AND: {
-        bool res = std::get<bool>(_stack.at(_stackPointer)) and std::get<bool>(_stack.at(_stackPointer - 1));
-        _stack.at(--_stackPointer) = res;
+        bool res = std::get<bool>(_stack[_stackPointer]) and std::get<bool>(_stack[_stackPointer - 1]);
+        _stack[--_stackPointer] = res;
         break;
       } break;
       case OR: {
-        bool res = std::get<bool>(_stack.at(_stackPointer)) or std::get<bool>(_stack.at(_stackPointer - 1));
-        _stack.at(--_stackPointer) = res;
+        bool res = std::get<bool>(_stack[_stackPointer]) or std::get<bool>(_stack[_stackPointer - 1]);
+        _stack[--_stackPointer] = res;
         break;
       }
       case POP:
@@ -230,33 +235,33 @@ class RuleVM {
         break;
       case MUL: {
         auto res =
-            computeBinary(_stack.at(_stackPointer - 1), _stack.at(_stackPointer), [](auto l, auto r) { return l * r; });
-        _stack.at(--_stackPointer) = res;
+            computeBinary(_stack[_stackPointer - 1], _stack[_stackPointer], [](auto l, auto r) { return l * r; });
+        _stack[--_stackPointer] = res;
         break;
       }
       case DIV: {
-        auto res = computeBinary(_stack.at(_stackPointer - 1), _stack.at(_stackPointer), [](auto l, auto r) {
+        auto res = computeBinary(_stack[_stackPointer - 1], _stack[_stackPointer], [](auto l, auto r) {
           // even though this is mathematically not correct it usually yields the intended result in boolean
           // expressions, e.g.: define isDomainExtremelyEmpty = numEmptyCells / numParticles > threshold;
           return r == 0 ? std::numeric_limits<decltype(l / r)>::max() : l / r;
         });
-        _stack.at(--_stackPointer) = res;
+        _stack[--_stackPointer] = res;
         break;
       }
       case ADD: {
         auto res =
-            computeBinary(_stack.at(_stackPointer - 1), _stack.at(_stackPointer), [](auto l, auto r) { return l + r; });
-        _stack.at(--_stackPointer) = res;
+            computeBinary(_stack[_stackPointer - 1], _stack[_stackPointer], [](auto l, auto r) { return l + r; });
+        _stack[--_stackPointer] = res;
         break;
       }
       case SUB: {
         auto res =
-            computeBinary(_stack.at(_stackPointer - 1), _stack.at(_stackPointer), [](auto l, auto r) { return l - r; });
-        _stack.at(--_stackPointer) = res;
+            computeBinary(_stack[_stackPointer - 1], _stack[_stackPointer], [](auto l, auto r) { return l - r; });
+        _stack[--_stackPointer] = res;
         break;
       }
       case NOT:
-        _stack.at(_stackPointer) = not std::get<bool>(_stack.at(_stackPointer));
+        _stack[_stackPointer] = not std::get<bool>(_stack[_stackPointer]);
         break;
     }
   }
@@ -280,7 +285,7 @@ class RuleVM {
             return false;
           }
         },
-        _stack.at(_stackPointer - 1), _stack.at(_stackPointer));
+        _stack[_stackPointer - 1], _stack[_stackPointer]);
     return res;
   }
 
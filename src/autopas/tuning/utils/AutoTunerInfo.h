@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <limits>
+
 #include "autopas/options/SelectorStrategyOption.h"
 #include "autopas/options/TuningMetricOption.h"
 namespace autopas {
@@ -34,5 +36,50 @@ struct AutoTunerInfo {
    * Flag for whether LOESS Smoothening is used to smoothen the tuning results.
    */
   bool useLOESSSmoothening{true};
+  /**
+   * Factor by which the first samples of a configuration may exceed the best evidence of the current tuning phase
+   * before the remaining samples of this configuration are skipped. Infinity disables early stopping.
+   */
+  double earlyStoppingFactor{std::numeric_limits<double>::infinity()};
+  /**
+   * Upper bound of samples per configuration for adaptive sampling. If this exceeds maxSamples, sampling of a
+   * configuration continues beyond maxSamples until its confidence interval separates it from the best configuration of
+   * the current tuning phase, and configurations whose confidence interval lies clearly above the best one are stopped
+   * before maxSamples is reached. Zero disables adaptive sampling.
+   */
+  unsigned int maxAdaptiveSamples{0};
+  /**
+   * Number of iterations between two exploration steps in continuous tuning. Zero disables continuous tuning.
+   * With continuous tuning, only the first tuning phase tests the whole search space and tuningInterval is ignored.
+   * Afterwards, the best known configuration is used and every explorationInterval iterations one configuration,
+   * chosen by an upper confidence bound, is sampled.
+   */
+  unsigned int explorationInterval{0};
+  /**
+   * Relative change of the runtime of the selected configuration after which continuous tuning or retuning on drift
+   * starts a new full tuning phase.
+   */
+  double driftThreshold{0.5};
+  /**
+   * If true, a new tuning phase is started as soon as the runtime of the selected configuration (see driftThreshold)
+   * or the particle distribution (see scenarioDriftThreshold) drifts. Regular tuning phases are postponed if neither
+   * drifted since the last tuning phase.
+   */
+  bool retuneOnDrift{false};
+  /**
+   * Change of homogeneity or maximum density, relative to the maximum density after the last tuning phase, that counts
+   * as drift of the particle distribution.
+   */
+  double scenarioDriftThreshold{0.3};
+  /**
+   * If true and the tuning metric is time, the optimum of a tuning phase is the configuration with the lowest expected
+   * time until the next tuning phase, including the measured cost of switching to its container.
+   */
+  bool considerSwitchCosts{false};
+  /**
+   * Relative slowdown compared to the fastest configuration of a tuning phase that the tuning metric
+   * energyBoundedSlowdown accepts in exchange for lower energy consumption.
+   */
+  double maxSlowdown{0.05};
 };
 }  // namespace autopas
\ No newline at end of file
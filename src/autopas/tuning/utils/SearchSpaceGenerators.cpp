@@ -19,11 +19,16 @@ std::set<Configuration> SearchSpaceGenerators::cartesianProduct(
     const std::set<ContainerOption> &allowedContainerOptions, const std::set<TraversalOption> &allowedTraversalOptions,
     const std::set<LoadEstimatorOption> &allowedLoadEstimatorOptions,
     const std::set<DataLayoutOption> &allowedDataLayoutOptions, const std::set<Newton3Option> &allowedNewton3Options,
-    const NumberSet<double> *allowedCellSizeFactors, const InteractionTypeOption &interactionType) {
+    const NumberSet<double> *allowedCellSizeFactors, const InteractionTypeOption &interactionType,
+    const std::set<unsigned int> &allowedRebuildFrequencies, const std::set<unsigned int> &allowedThreadCounts,
+    const std::set<unsigned int> &allowedChunkSizes) {
   if (allowedCellSizeFactors->isInterval()) {
     utils::ExceptionHandler::exception("Cross product does not work with continuous cell size factors!");
   }
   const auto cellSizeFactors = allowedCellSizeFactors->getAll();
+  const auto chunkSizeTraversals = compatibleTraversals::allTraversalsSupportingChunkSize();
+  // Traversals that ignore the chunk size are only generated once with the default.
+  const std::set<unsigned int> defaultChunkSize{0};
 
   std::set<Configuration> searchSet;
   // generate all potential configs
@@ -40,14 +45,25 @@ std::set<Configuration> SearchSpaceGenerators::cartesianProduct(
       // if load estimators are not applicable LoadEstimatorOption::none is returned.
       const std::set<LoadEstimatorOption> allowedAndApplicableLoadEstimators =
           loadEstimators::getApplicableLoadEstimators(containerOption, traversalOption, allowedLoadEstimatorOptions);
+      const auto &chunkSizes =
+          chunkSizeTraversals.count(traversalOption) != 0 ? allowedChunkSizes : defaultChunkSize;
       for (const auto csf : cellSizeFactors) {
         for (const auto &loadEstimatorOption : allowedAndApplicableLoadEstimators) {
           for (const auto &dataLayoutOption : allowedDataLayoutOptions) {
             for (const auto &newton3Option : allowedNewton3Options) {
-              const Configuration configuration{containerOption,  csf,           traversalOption, loadEstimatorOption,
-                                                dataLayoutOption, newton3Option, interactionType};
-              if (configuration.hasCompatibleValues()) {
-                searchSet.insert(configuration);
+              for (const auto rebuildFrequency : allowedRebuildFrequencies) {
+                for (const auto threadCount : allowedThreadCounts) {
+                  for (const auto chunkSize : chunkSizes) {
+                    const Configuration configuration{containerOption,  csf,
+                                                      traversalOption,  loadEstimatorOption,
+                                                      dataLayoutOption, newton3Option,
+                                                      interactionType,  rebuildFrequency,
+                                                      threadCount,      chunkSize};
+                    if (configuration.hasCompatibleValues()) {
+                      searchSet.insert(configuration);
+                    }
+                  }
+                }
               }
             }
           }
@@ -65,13 +81,17 @@ std::set<Configuration> SearchSpaceGenerators::cartesianProduct(
 SearchSpaceGenerators::OptionSpace SearchSpaceGenerators::inferOptionDimensions(
     const std::set<Configuration> &searchSet) {
   OptionSpace optionSpace;
-  for (const auto &[container, traversal, loadEst, dataLayout, newton3, csf, interactT] : searchSet) {
+  for (const auto &[container, traversal, loadEst, dataLayout, newton3, csf, interactT, rebuildFrequency, threadCount,
+                    chunkSize] : searchSet) {
     optionSpace.containerOptions.insert(container);
     optionSpace.traversalOptions.insert(traversal);
     optionSpace.loadEstimatorOptions.insert(loadEst);
     optionSpace.dataLayoutOptions.insert(dataLayout);
     optionSpace.newton3Options.insert(newton3);
     optionSpace.cellSizeFactors.insert(csf);
+    optionSpace.rebuildFrequencies.insert(rebuildFrequency);
+    optionSpace.threadCounts.insert(threadCount);
+    optionSpace.chunkSizes.insert(chunkSize);
   }
   return optionSpace;
 }
@@ -54,6 +54,18 @@ struct OptionSpace {
    * Available discrete cellSizeFactors options.
    */
   std::set<double> cellSizeFactors;
+  /**
+   * Available rebuild frequencies.
+   */
+  std::set<unsigned int> rebuildFrequencies;
+  /**
+   * Available OpenMP thread counts.
+   */
+  std::set<unsigned int> threadCounts;
+  /**
+   * Available OpenMP chunk sizes.
+   */
+  std::set<unsigned int> chunkSizes;
 };
 
 /**
@@ -66,6 +78,10 @@ struct OptionSpace {
  * @param allowedNewton3Options
  * @param allowedCellSizeFactors
  * @param interactionType
+ * @param allowedRebuildFrequencies Zero stands for the rebuild frequency AutoPas was initialized with.
+ * @param allowedThreadCounts Zero stands for all available OpenMP threads.
+ * @param allowedChunkSizes Zero stands for the default chunk size of the traversals. Only applied to traversals that
+ * support a chunk size. All others only use the default.
  * @return A set containing all valid configurations.
  */
 std::set<Configuration> cartesianProduct(const std::set<ContainerOption> &allowedContainerOptions,
@@ -74,7 +90,10 @@ std::set<Configuration> cartesianProduct(const std::set<ContainerOption> &allowe
                                          const std::set<DataLayoutOption> &allowedDataLayoutOptions,
                                          const std::set<Newton3Option> &allowedNewton3Options,
                                          const NumberSet<double> *allowedCellSizeFactors,
-                                         const InteractionTypeOption &interactionType);
+                                         const InteractionTypeOption &interactionType,
+                                         const std::set<unsigned int> &allowedRebuildFrequencies = {0},
+                                         const std::set<unsigned int> &allowedThreadCounts = {0},
+                                         const std::set<unsigned int> &allowedChunkSizes = {0});
 
 /**
  * Crudely trying to reconstruct the dimensions of the search space from a given set of options.
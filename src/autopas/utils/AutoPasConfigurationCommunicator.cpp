@@ -191,6 +191,9 @@ SerializedConfiguration serializeConfiguration(Configuration configuration) {
   config[5] = castToByte(configuration.interactionType);
   // Doubles can't be easily truncated, so store all 8 bytes via memcpy
   std::memcpy(&config[6], &configuration.cellSizeFactor, sizeof(double));
+  std::memcpy(&config[14], &configuration.rebuildFrequency, sizeof(unsigned int));
+  std::memcpy(&config[18], &configuration.threadCount, sizeof(unsigned int));
+  std::memcpy(&config[22], &configuration.chunkSize, sizeof(unsigned int));
   return config;
 }
 
@@ -210,11 +213,18 @@ std::vector<std::byte> serializeConfigurations(const std::vector<Configuration>
 Configuration deserializeConfiguration(SerializedConfiguration config) {
   double cellSizeFactor{0.};
   std::memcpy(&cellSizeFactor, &config[6], sizeof(double));
+  unsigned int rebuildFrequency{0};
+  std::memcpy(&rebuildFrequency, &config[14], sizeof(unsigned int));
+  unsigned int threadCount{0};
+  std::memcpy(&threadCount, &config[18], sizeof(unsigned int));
+  unsigned int chunkSize{0};
+  std::memcpy(&chunkSize, &config[22], sizeof(unsigned int));
   return {
       static_cast<ContainerOption::Value>(config[0]),       cellSizeFactor,
       static_cast<TraversalOption::Value>(config[1]),       static_cast<LoadEstimatorOption::Value>(config[2]),
       static_cast<DataLayoutOption::Value>(config[3]),      static_cast<Newton3Option::Value>(config[4]),
-      static_cast<InteractionTypeOption::Value>(config[5]),
+      static_cast<InteractionTypeOption::Value>(config[5]), rebuildFrequency,
+      threadCount,                                          chunkSize,
   };
 }
 
@@ -235,6 +245,24 @@ std::vector<Configuration> deserializeConfigurations(const std::vector<std::byte
   return configurations;
 }
 
+SerializedConfigurationAndValue serializeConfigurationAndValue(const Configuration &configuration, long value) {
+  constexpr auto serializedConfSize = std::tuple_size_v<SerializedConfiguration>;
+  SerializedConfigurationAndValue serialized{};
+  const auto serializedConf = serializeConfiguration(configuration);
+  std::copy(serializedConf.begin(), serializedConf.end(), serialized.begin());
+  std::memcpy(&serialized[serializedConfSize], &value, sizeof(long));
+  return serialized;
+}
+
+std::pair<Configuration, long> deserializeConfigurationAndValue(const SerializedConfigurationAndValue &serialized) {
+  constexpr auto serializedConfSize = std::tuple_size_v<SerializedConfiguration>;
+  SerializedConfiguration serializedConf{};
+  std::copy(serialized.begin(), serialized.begin() + serializedConfSize, serializedConf.begin());
+  long value{0};
+  std::memcpy(&value, &serialized[serializedConfSize], sizeof(long));
+  return {deserializeConfiguration(serializedConf), value};
+}
+
 void distributeRanksInBuckets(AutoPas_MPI_Comm comm, AutoPas_MPI_Comm *bucket, double smoothedHomogeneity,
                               double maxDensity, double MPITuningMaxDifferenceForBucket,
                               double MPITuningWeightForMaxDensity) {
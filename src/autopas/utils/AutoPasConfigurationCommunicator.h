@@ -8,6 +8,7 @@
 
 #include <array>
 #include <cstddef>
+#include <utility>
 #include <vector>
 
 #include "WrapMPI.h"
@@ -26,9 +27,14 @@
 namespace autopas::utils::AutoPasConfigurationCommunicator {
 
 /**
- * type definition for the serialization of configurations. A serialized config is an array of 14 bytes.
+ * type definition for the serialization of configurations. A serialized config is an array of 26 bytes.
  * */
-using SerializedConfiguration = std::array<std::byte, 14>;
+using SerializedConfiguration = std::array<std::byte, 26>;
+
+/**
+ * type definition for the serialization of a configuration followed by a value of type long.
+ */
+using SerializedConfigurationAndValue = std::array<std::byte, std::tuple_size_v<SerializedConfiguration> + sizeof(long)>;
 
 /**
  * Simply a shorter way of static_casting from Option to std::byte.
@@ -126,6 +132,21 @@ Configuration deserializeConfiguration(SerializedConfiguration config);
  */
 std::vector<Configuration> deserializeConfigurations(const std::vector<std::byte> &configurationsSerialized);
 
+/**
+ * Serializes a configuration together with a measured value, e.g. the value of its evidence.
+ * @param configuration
+ * @param value
+ * @return The serialized configuration followed by the bytes of the value.
+ */
+SerializedConfigurationAndValue serializeConfigurationAndValue(const Configuration &configuration, long value);
+
+/**
+ * Recreates a configuration and its value from the object obtained by serializeConfigurationAndValue().
+ * @param serialized
+ * @return Pair of configuration and value.
+ */
+std::pair<Configuration, long> deserializeConfigurationAndValue(const SerializedConfigurationAndValue &serialized);
+
 /**
  * Handles communication to select the globally best configuration.
  * @param comm: The communicator used for sending and receiving the optimal configuration.
@@ -0,0 +1,162 @@
+/**
+ * @file CpuFrequencyMeter.cpp
+ * @date 18.10.26
+ */
+
+#include "autopas/utils/CpuFrequencyMeter.h"
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include <fstream>
+#include <functional>
+#include <numeric>
+#include <optional>
+#include <string>
+
+#include "autopas/utils/ExceptionHandler.h"
+#include "autopas/utils/WrapOpenMP.h"
+#include "autopas/utils/logging/Logger.h"
+
+namespace autopas::utils {
+
+namespace {
+/**
+ * Reads a single integer from a file in /sys/devices/system/cpu/cpu<cpu>/.
+ * @param cpu
+ * @param file Path relative to the directory of the cpu.
+ * @return Value or nullopt if the file can not be read.
+ */
+std::optional<long> readCpuValue(int cpu, const std::string &file) {
+  std::ifstream stream("/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/" + file);
+  long value{};
+  if (stream >> value) {
+    return value;
+  }
+  return std::nullopt;
+}
+
+/**
+ * Returns a predicate that tells if any thread of this process may run on a CPU. The affinity masks of all OpenMP
+ * threads are combined, because with pinned threads the mask of a single thread only contains its own CPU.
+ * @return Predicate that is always true if the affinity can not be determined.
+ */
+std::function<bool(int)> affinityPredicate() {
+#ifdef __linux__
+  cpu_set_t processMask;
+  CPU_ZERO(&processMask);
+  AUTOPAS_OPENMP(parallel) {
+    cpu_set_t threadMask;
+    CPU_ZERO(&threadMask);
+    if (sched_getaffinity(0, sizeof(threadMask), &threadMask) == 0) {
+      AUTOPAS_OPENMP(critical) { CPU_OR(&processMask, &processMask, &threadMask); }
+    }
+  }
+  if (CPU_COUNT(&processMask) > 0) {
+    return [processMask](int cpu) { return cpu < CPU_SETSIZE and CPU_ISSET(cpu, &processMask); };
+  }
+#endif
+  return [](int) { return true; };
+}
+
+/**
+ * Mean of values in kHz converted to MHz.
+ * @param values
+ * @return
+ */
+double meanInMHz(const std::vector<long> &values) {
+  return static_cast<double>(std::accumulate(values.begin(), values.end(), 0l)) / 1000. /
+         static_cast<double>(values.size());
+}
+}  // namespace
+
+bool CpuFrequencyMeter::init(bool mustSucceed) {
+  // Only CPUs this process runs on are relevant, the others may be idle or busy with other jobs.
+  const auto processMayRunOn = affinityPredicate();
+  // CPUs are numbered consecutively, so stop at the first one that does not exist.
+  for (int cpu = 0; readCpuValue(cpu, "topology/physical_package_id").has_value(); ++cpu) {
+    if (processMayRunOn(cpu) and readCpuValue(cpu, "cpufreq/scaling_cur_freq").has_value()) {
+      _cpus.push_back(cpu);
+    }
+  }
+  if (_cpus.empty()) {
+    const auto errMsg = "CpuFrequencyMeter::init(): The CPU frequency can not be read from /sys.";
+    if (mustSucceed) {
+      utils::ExceptionHandler::exception(errMsg);
+    }
+    AutoPasLog(WARN, errMsg);
+    return false;
+  }
+
+  std::vector<long> referenceFrequencies{};
+  referenceFrequencies.reserve(_cpus.size());
+  for (const auto cpu : _cpus) {
+    const auto baseFrequency = readCpuValue(cpu, "cpufreq/base_frequency");
+    const auto referenceFrequency =
+        baseFrequency.has_value() ? baseFrequency : readCpuValue(cpu, "cpufreq/cpuinfo_max_freq");
+    if (referenceFrequency.has_value()) {
+      referenceFrequencies.push_back(*referenceFrequency);
+    }
+  }
+  if (referenceFrequencies.empty()) {
+    // Without any hardware information, the frequency at initialization is the reference.
+    referenceFrequencies = readFrequencies();
+  }
+  _referenceFrequency = meanInMHz(referenceFrequencies);
+  AutoPasLog(DEBUG, "CpuFrequencyMeter: Reading the frequency of {} CPUs. Reference frequency: {} MHz", _cpus.size(),
+             _referenceFrequency);
+  reset();
+  return true;
+}
+
+void CpuFrequencyMeter::reset() {
+  _startFrequencies = readFrequencies();
+  _startThrottleCounts = readThrottleCounts();
+}
+
+void CpuFrequencyMeter::sample() {
+  if (_cpus.empty()) {
+    return;
+  }
+  auto frequencies = readFrequencies();
+  for (size_t i = 0; i < frequencies.size(); ++i) {
+    frequencies[i] = (frequencies[i] + _startFrequencies[i]) / 2;
+  }
+  _meanFrequency = meanInMHz(frequencies);
+
+  const auto throttleCounts = readThrottleCounts();
+  _throttleEvents = 0;
+  for (size_t i = 0; i < throttleCounts.size(); ++i) {
+    _throttleEvents += throttleCounts[i] - _startThrottleCounts[i];
+  }
+}
+
+double CpuFrequencyMeter::get_mean_frequency() const { return _meanFrequency; }
+
+long CpuFrequencyMeter::get_throttle_events() const { return _throttleEvents; }
+
+double CpuFrequencyMeter::get_reference_frequency() const { return _referenceFrequency; }
+
+std::vector<long> CpuFrequencyMeter::readFrequencies() const {
+  std::vector<long> frequencies{};
+  frequencies.reserve(_cpus.size());
+  for (const auto cpu : _cpus) {
+    // A CPU that can not be read anymore, e.g. because it went offline, counts with its previous frequency.
+    const auto previousFrequency =
+        frequencies.size() < _startFrequencies.size() ? _startFrequencies[frequencies.size()] : 0l;
+    frequencies.push_back(readCpuValue(cpu, "cpufreq/scaling_cur_freq").value_or(previousFrequency));
+  }
+  return frequencies;
+}
+
+std::vector<long> CpuFrequencyMeter::readThrottleCounts() const {
+  std::vector<long> throttleCounts{};
+  throttleCounts.reserve(_cpus.size());
+  for (const auto cpu : _cpus) {
+    throttleCounts.push_back(readCpuValue(cpu, "thermal_throttle/core_throttle_count").value_or(0l));
+  }
+  return throttleCounts;
+}
+
+}  // namespace autopas::utils
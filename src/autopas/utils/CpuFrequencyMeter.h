@@ -0,0 +1,109 @@
+/**
+ * @file CpuFrequencyMeter.h
+ * @date 18.10.26
+ */
+
+#pragma once
+
+#include <limits>
+#include <vector>
+
+namespace autopas::utils {
+
+/**
+ * Measures the mean CPU frequency and the number of thermal throttling events between calls of reset() and sample()
+ * via the cpufreq and thermal_throttle interfaces in /sys.
+ *
+ * Only CPUs in the affinity masks of the threads of this process are considered. The frequency of each of them is read
+ * at reset() and at sample() and the mean of both readings over these CPUs is used as the frequency of the
+ * measurement. This is an approximation: scaling_cur_freq is a snapshot and not an average over the measured
+ * interval, and a CPU in the mask might not have been busy with this process the whole time. An exact average would
+ * need the APERF and MPERF registers, which are usually not accessible without root rights. Throttling events are only
+ * counted if the kernel provides core_throttle_count.
+ */
+class CpuFrequencyMeter {
+ public:
+  /**
+   * Initialization may fail, so moved out of constructor.
+   * Note: Like RaplMeter::init(), this does not throw on failure unless explicitly requested.
+   * @param mustSucceed Bool indicating whether this method should throw on failure.
+   * @return True if the frequency of at least one CPU can be read.
+   */
+  bool init(bool mustSucceed);
+
+  /**
+   * Start a new measurement.
+   */
+  void reset();
+
+  /**
+   * Measure frequency and throttling since the last call to reset().
+   * The results can be retrieved with get_mean_frequency() and get_throttle_events().
+   */
+  void sample();
+
+  /**
+   * Returns the mean frequency of the considered CPUs between the last call to sample() and the preceding call to
+   * reset().
+   * @return Frequency in MHz or NaN if no measurement is available.
+   */
+  double get_mean_frequency() const;
+
+  /**
+   * Returns the number of thermal throttling events of all CPUs between the last call to sample() and the preceding
+   * call to reset().
+   * @return
+   */
+  long get_throttle_events() const;
+
+  /**
+   * Returns the frequency energy measurements are normalized to. This is the mean base frequency of the considered
+   * CPUs or, if the kernel does not provide it, the mean maximal frequency.
+   * @return Frequency in MHz or NaN if no measurement is available.
+   */
+  double get_reference_frequency() const;
+
+ private:
+  /**
+   * Reads the frequency of every CPU in kHz.
+   * @return
+   */
+  std::vector<long> readFrequencies() const;
+
+  /**
+   * Reads the throttling counter of every CPU.
+   * @return
+   */
+  std::vector<long> readThrottleCounts() const;
+
+  /**
+   * IDs of all CPUs this process may run on and whose frequency can be read.
+   */
+  std::vector<int> _cpus{};
+
+  /**
+   * Frequencies of all CPUs in kHz at the last call to reset().
+   */
+  std::vector<long> _startFrequencies{};
+
+  /**
+   * Throttling counters of all CPUs at the last call to reset().
+   */
+  std::vector<long> _startThrottleCounts{};
+
+  /**
+   * Mean frequency in MHz of the last measurement.
+   */
+  double _meanFrequency{std::numeric_limits<double>::quiet_NaN()};
+
+  /**
+   * Number of throttling events of the last measurement.
+   */
+  long _throttleEvents{0};
+
+  /**
+   * Reference frequency in MHz.
+   */
+  double _referenceFrequency{std::numeric_limits<double>::quiet_NaN()};
+};
+}  // namespace autopas::utils
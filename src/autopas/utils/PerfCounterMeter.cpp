@@ -0,0 +1,180 @@
+/**
+ * @file PerfCounterMeter.cpp
+ * @date 18.10.26
+ */
+
+#include "autopas/utils/PerfCounterMeter.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#ifdef AUTOPAS_ENABLE_PERF_COUNTERS
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#endif
+
+#include "autopas/utils/ExceptionHandler.h"
+#include "autopas/utils/WrapOpenMP.h"
+#include "autopas/utils/logging/Logger.h"
+
+namespace autopas::utils {
+
+#ifdef AUTOPAS_ENABLE_PERF_COUNTERS
+namespace {
+/**
+ * Opens a user space counter for the calling thread on any cpu.
+ * @param type
+ * @param config
+ * @return File descriptor or -1 if the event is not available.
+ */
+int openPerfEvent(uint32_t type, uint64_t config) {
+  perf_event_attr attr;
+  std::memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = type;
+  attr.config = config;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  // If there are more events than hardware counters, the kernel multiplexes them. The times the event was enabled and
+  // actually running are needed to extrapolate the count.
+  attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0 /*PID*/, -1 /*CPU*/, -1 /*GROUP FD*/, 0 /*FLAGS*/));
+}
+}  // namespace
+#endif
+
+bool PerfCounterMeter::init(const std::vector<Event> &requiredEvents) {
+#ifdef AUTOPAS_ENABLE_PERF_COUNTERS
+  const std::array<std::pair<uint32_t, uint64_t>, numEvents> eventConfigs{{
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+      {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                               (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+  }};
+
+  // Counters only count the thread that opened them, so every thread of the pool opens its own.
+  _fds.resize(autopas_get_max_threads());
+  AUTOPAS_OPENMP(parallel num_threads(_fds.size())) {
+    auto &threadFds = _fds[autopas_get_thread_num()];
+    for (size_t event = 0; event < numEvents; ++event) {
+      threadFds[event] = openPerfEvent(eventConfigs[event].first, eventConfigs[event].second);
+    }
+  }
+
+  bool anyEventAvailable{false};
+  for (size_t event = 0; event < numEvents; ++event) {
+    const bool eventAvailable =
+        std::all_of(_fds.begin(), _fds.end(), [&](const auto &threadFds) { return threadFds[event] != -1; });
+    if (not eventAvailable) {
+      // Only count an event if it is available for all threads.
+      for (auto &threadFds : _fds) {
+        if (threadFds[event] != -1) {
+          close(threadFds[event]);
+          threadFds[event] = -1;
+        }
+      }
+      AutoPasLog(DEBUG, "PerfCounterMeter: Event {} is not available.", event);
+    }
+    anyEventAvailable |= eventAvailable;
+  }
+  _start.resize(_fds.size());
+
+  for (const auto event : requiredEvents) {
+    if (not isAvailable(event)) {
+      utils::ExceptionHandler::exception(
+          "PerfCounterMeter::init(): Required hardware counter {} is not available. Check perf_event_paranoid.",
+          static_cast<int>(event));
+    }
+  }
+  if (not anyEventAvailable) {
+    AutoPasLog(WARN, "PerfCounterMeter::init(): No hardware counters available. Check perf_event_paranoid.");
+    return false;
+  }
+  reset();
+  return true;
+#else
+  if (not requiredEvents.empty()) {
+    utils::ExceptionHandler::exception(
+        "Trying to initialize PerfCounterMeter but AUTOPAS_ENABLE_PERF_COUNTERS is disabled.");
+  }
+  return false;
+#endif
+}
+
+bool PerfCounterMeter::isAvailable(Event event) const {
+  return not _fds.empty() and
+         std::all_of(_fds.begin(), _fds.end(), [&](const auto &threadFds) { return threadFds[event] != -1; });
+}
+
+PerfCounterMeter::~PerfCounterMeter() {
+#ifdef AUTOPAS_ENABLE_PERF_COUNTERS
+  for (const auto &threadFds : _fds) {
+    for (const auto fd : threadFds) {
+      if (fd != -1) {
+        close(fd);
+      }
+    }
+  }
+#endif
+}
+
+void PerfCounterMeter::reset() {
+  for (size_t thread = 0; thread < _fds.size(); ++thread) {
+    for (size_t event = 0; event < numEvents; ++event) {
+      _start[thread][event] = readCounter(_fds[thread][event]);
+    }
+  }
+}
+
+void PerfCounterMeter::sample() {
+  _values.fill(0);
+  for (size_t thread = 0; thread < _fds.size(); ++thread) {
+    for (size_t event = 0; event < numEvents; ++event) {
+      const auto current = readCounter(_fds[thread][event]);
+      const auto &start = _start[thread][event];
+      const auto timeEnabled = current.timeEnabled - start.timeEnabled;
+      const auto timeRunning = current.timeRunning - start.timeRunning;
+      // Scale multiplexed counters up to the whole interval. A counter that never ran has no information.
+      if (timeRunning != 0) {
+        _values[event] += static_cast<long>(static_cast<double>(current.value - start.value) *
+                                            static_cast<double>(timeEnabled) / static_cast<double>(timeRunning));
+      }
+    }
+  }
+}
+
+long PerfCounterMeter::get_instructions() const { return _values[instructions]; }
+long PerfCounterMeter::get_cycles() const { return _values[cycles]; }
+long PerfCounterMeter::get_l1_misses() const { return _values[l1Misses]; }
+long PerfCounterMeter::get_llc_misses() const { return _values[llcMisses]; }
+
+double PerfCounterMeter::get_ipc() const {
+  if (_values[instructions] == 0 or _values[cycles] == 0) {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+  return static_cast<double>(_values[instructions]) / static_cast<double>(_values[cycles]);
+}
+
+PerfCounterMeter::CounterReading PerfCounterMeter::readCounter(int fd) {
+  CounterReading reading{};
+#ifdef AUTOPAS_ENABLE_PERF_COUNTERS
+  if (fd == -1) {
+    return reading;
+  }
+  // Layout given by read_format: value, time enabled, time running.
+  std::array<uint64_t, 3> buffer{};
+  if (read(fd, buffer.data(), sizeof(buffer)) != sizeof(buffer)) {
+    utils::ExceptionHandler::exception("PerfCounterMeter: Failed to read perf event: {}", std::strerror(errno));
+  }
+  reading = {buffer[0], buffer[1], buffer[2]};
+#endif
+  return reading;
+}
+
+}  // namespace autopas::utils
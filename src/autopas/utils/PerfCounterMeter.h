@@ -0,0 +1,131 @@
+/**
+ * @file PerfCounterMeter.h
+ * @date 18.10.26
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace autopas::utils {
+
+/**
+ * Counts hardware events (instructions, cycles, L1 data cache misses, last level cache misses) between calls of
+ * reset() and sample() using perf events.
+ *
+ * Counters are opened for every OpenMP thread, so only the threads of the OpenMP pool at the time of init() are
+ * counted. Events the hardware or the kernel does not provide are skipped and read as zero. If the kernel multiplexes
+ * the counters, the counts are extrapolated to the whole measurement. This requires a perf_event_paranoid value of 2 or
+ * less.
+ */
+class PerfCounterMeter {
+ public:
+  /**
+   * Indices of the supported events.
+   */
+  enum Event { instructions, cycles, l1Misses, llcMisses, numEvents };
+
+  ~PerfCounterMeter();
+
+  /**
+   * Initialization may fail, so moved out of constructor.
+   * Note: Like RaplMeter::init(), this does not throw on failure unless explicitly requested.
+   * @param requiredEvents Events that have to be available. If any of them is not, this method throws.
+   * @return True if at least one counter is available.
+   */
+  bool init(const std::vector<Event> &requiredEvents);
+
+  /**
+   * Checks if an event is counted on all threads.
+   * @param event
+   * @return True if the event is available.
+   */
+  bool isAvailable(Event event) const;
+
+  /**
+   * Start a new measurement.
+   */
+  void reset();
+
+  /**
+   * Measure the events since the last call to reset().
+   * The results can be retrieved with the get_<event>() functions.
+   */
+  void sample();
+
+  /**
+   * Returns the number of retired instructions between the last call to sample() and the preceding call to reset().
+   * @return
+   */
+  long get_instructions() const;
+
+  /**
+   * Returns the number of CPU cycles between the last call to sample() and the preceding call to reset().
+   * @return
+   */
+  long get_cycles() const;
+
+  /**
+   * Returns the number of L1 data cache read misses between the last call to sample() and the preceding call to
+   * reset().
+   * @return
+   */
+  long get_l1_misses() const;
+
+  /**
+   * Returns the number of last level cache misses between the last call to sample() and the preceding call to
+   * reset().
+   * @return
+   */
+  long get_llc_misses() const;
+
+  /**
+   * Returns instructions per cycle of the last measurement.
+   * @return IPC or NaN if instructions or cycles are not available.
+   */
+  double get_ipc() const;
+
+ private:
+  /**
+   * Raw counter value and the times the counter was enabled and actually running on the hardware.
+   */
+  struct CounterReading {
+    /**
+     * Raw count.
+     */
+    uint64_t value;
+    /**
+     * Time in ns the counter was enabled.
+     */
+    uint64_t timeEnabled;
+    /**
+     * Time in ns the counter was running. Smaller than timeEnabled if the counter was multiplexed.
+     */
+    uint64_t timeRunning;
+  };
+
+  /**
+   * File descriptors of all events for every thread. -1 marks events that are not available.
+   */
+  std::vector<std::array<int, numEvents>> _fds{};
+
+  /**
+   * Counter readings of all events for every thread at the last call to reset().
+   */
+  std::vector<std::array<CounterReading, numEvents>> _start{};
+
+  /**
+   * Counter differences between the last calls to reset() and sample(), scaled for multiplexing.
+   */
+  std::array<long, numEvents> _values{};
+
+  /**
+   * Reads a single counter.
+   * @param fd File descriptor of the counter. For -1 a zero reading is returned.
+   * @return
+   */
+  static CounterReading readCounter(int fd);
+};
+}  // namespace autopas::utils
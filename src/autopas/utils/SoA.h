@@ -46,6 +46,17 @@ class SoA {
     soaStorage.apply([=](auto &list) { list.resize(length); });
   }
 
+  /**
+   * Resizes only the vectors of the given attributes to the given length.
+   * All other vectors are emptied and their memory is released, so only the given attributes are loaded.
+   * @tparam attributes Attributes whose vectors are resized.
+   * @param length new length.
+   */
+  template <int... attributes>
+  void resizeArrays(size_t length) {
+    resizeArrays_impl<attributes...>(length, std::make_index_sequence<std::tuple_size<SoAArraysType>::value>{});
+  }
+
   /**
    * Pushes a given value to the desired attribute array.
    * @tparam attribute Index of array to push to.
@@ -70,21 +81,25 @@ class SoA {
 
   /**
    * Appends the other SoA buffer to this.
+   * Only the loaded attributes of the other buffer are appended, so both have to have the same attributes loaded.
    * @param other Other buffer.
    */
   void append(const SoA<SoAArraysType> &other) {
     if (other.size() > 0) {
       append_impl(other.soaStorage, std::make_index_sequence<std::tuple_size<SoAArraysType>::value>{});
+      checkLoadedArraySizes();
     }
   }
 
   /**
    * Appends the other SoA buffer to this.
+   * Only the loaded attributes of the viewed buffer are appended, so both have to have the same attributes loaded.
    * @param other Other buffer.
    */
   void append(const SoAView<SoAArraysType> &other) {
     if (other.size() > 0) {
       append_impl(other, std::make_index_sequence<std::tuple_size<SoAArraysType>::value>{});
+      checkLoadedArraySizes();
     }
   }
 
@@ -203,11 +218,26 @@ class SoA {
     soaStorage.apply([](auto &list) { list.pop_back(); });
   }
 
+  /**
+   * Checks if the array of the given attribute holds a value for every particle.
+   * After resizeArrays<attributes...>(), only the arrays of the given attributes are loaded.
+   * @tparam attribute
+   * @return True if the array is loaded.
+   */
+  template <std::size_t attribute>
+  [[nodiscard]] bool isLoaded() const {
+    return soaStorage.template get<attribute>().size() == size();
+  }
+
   /**
    * Constructs a SoAView for the whole SoA and returns it.
+   * Its size is the one of the loaded arrays, which all have to have the same length.
    * @return the constructed SoAView on the whole SoA.
    */
-  SoAView<SoAArraysType> constructView() { return {this, 0, size()}; }
+  SoAView<SoAArraysType> constructView() {
+    checkLoadedArraySizes();
+    return {this, 0, size()};
+  }
 
   /**
    * Constructs a view that starts at \p startIndex (inclusive) and ends at \p endIndex (exclusive).
@@ -221,6 +251,41 @@ class SoA {
   SoAView<SoAArraysType> constructView(size_t startIndex, size_t endIndex) { return {this, startIndex, endIndex}; }
 
  private:
+  // checks if attribute is one of attributes
+  template <int... attributes>
+  static constexpr bool isOneOf(std::size_t attribute) {
+    return ((attribute == static_cast<std::size_t>(attributes)) or ...);
+  }
+
+  // actual implementation of the partial resize
+  template <int... attributes, std::size_t... Is>
+  void resizeArrays_impl(size_t length, std::index_sequence<Is...>) {
+    // fold expression
+    (resizeOrReleaseArray<Is>(isOneOf<attributes...>(Is), length), ...);
+  }
+
+  // resizes a needed array and releases the memory of all others
+  template <std::size_t attribute>
+  void resizeOrReleaseArray(bool needed, size_t length) {
+    auto &array = soaStorage.template get<attribute>();
+    if (needed) {
+      array.resize(length);
+    } else {
+      array.clear();
+      array.shrink_to_fit();
+    }
+  }
+
+  // Arrays that are not loaded are empty, all others have to hold a value for every particle.
+  void checkLoadedArraySizes() const {
+    const auto length = size();
+    utils::TupleUtils::for_each(soaStorage.getTuple(), [&](auto &v) {
+      if (not v.empty() and v.size() != length) /* @todo C++20 [[unlikely]] */ {
+        utils::ExceptionHandler::exception("SoA: Loaded arrays differ in length ({} vs. {}).", v.size(), length);
+      }
+    });
+  }
+
   // actual implementation of read
   template <int attribute, int... attributes, class ValueArrayType>
   void read_impl(size_t particleId, ValueArrayType &values, int _current = 0) const {
@@ -255,6 +320,10 @@ class SoA {
   // helper function to append a single array
   template <std::size_t attribute>
   void appendSingleArray(const SoAView<SoAArraysType> &valArrays) {
+    // arrays that are not loaded in the viewed SoA hold no values to read
+    if (not valArrays.template isLoaded<attribute>()) {
+      return;
+    }
     auto &currentVector = soaStorage.template get<attribute>();
     auto otherVectorIterator = valArrays.template begin<attribute>();
     currentVector.insert(currentVector.end(), otherVectorIterator, otherVectorIterator + valArrays.size());
@@ -75,6 +75,16 @@ class SoAView {
     return _soa->template begin<attribute>() + _startIndex;
   }
 
+  /**
+   * Checks if the array of the given attribute is loaded in the underlying SoA.
+   * @tparam attribute ID of the desired attribute.
+   * @return True if the array holds a value for every particle.
+   */
+  template <size_t attribute>
+  [[nodiscard]] bool isLoaded() const {
+    return _soa->template isLoaded<attribute>();
+  }
+
   /**
    * Returns the number of particles in the view.
    *
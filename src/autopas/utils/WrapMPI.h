@@ -608,6 +608,22 @@ inline int AutoPas_MPI_Allgather(void *buffer_send, int count_send, AutoPas_MPI_
                                  void *buffer_recv, int count_recv, AutoPas_MPI_Datatype datatype_recv,
                                  AutoPas_MPI_Comm comm);
 
+/**
+ * Wrapper for MPI_Iallgather
+ * @param buffer_send: send buffer
+ * @param count_send: number of elements in send buffer
+ * @param datatype_send: type of elements in send buffer
+ * @param buffer_recv: receive buffer
+ * @param count_recv: number of elements received from each rank
+ * @param datatype_recv: type of elements in receive buffer
+ * @param comm: communicator (handle)
+ * @param request: outputs communication request (handle)
+ * @return
+ */
+inline int AutoPas_MPI_Iallgather(const void *buffer_send, int count_send, AutoPas_MPI_Datatype datatype_send,
+                                  void *buffer_recv, int count_recv, AutoPas_MPI_Datatype datatype_recv,
+                                  AutoPas_MPI_Comm comm, AutoPas_MPI_Request *request);
+
 /**
  * Wrapper for MPI_Comm_split
  * @param old_communicator: old communicator (handle)
@@ -756,6 +772,12 @@ inline int AutoPas_MPI_Allgather(void *buffer_send, int count_send, AutoPas_MPI_
   return MPI_Allgather(buffer_send, count_send, datatype_send, buffer_recv, count_recv, datatype_recv, comm);
 }
 
+inline int AutoPas_MPI_Iallgather(const void *buffer_send, int count_send, AutoPas_MPI_Datatype datatype_send,
+                                  void *buffer_recv, int count_recv, AutoPas_MPI_Datatype datatype_recv,
+                                  AutoPas_MPI_Comm comm, AutoPas_MPI_Request *request) {
+  return MPI_Iallgather(buffer_send, count_send, datatype_send, buffer_recv, count_recv, datatype_recv, comm, request);
+}
+
 #else
 
 inline int AutoPas_MPI_Init(int *argc, char ***argv) { return AUTOPAS_MPI_SUCCESS; }
@@ -910,8 +932,9 @@ inline int AutoPas_MPI_Gather(const void *buffer_send, int count_send, AutoPas_M
   if (buffer_send != AUTOPAS_MPI_IN_PLACE) {
     for (long i = 0; i < (count_recv / count_send); i++)
       // offsets from pointers are of type ptrdiff_t which is an alias for long. Hence, i should be long.
-      memcpy(static_cast<char *>(buffer_recv) + (i * count_send * sizeof(datatype_send)), buffer_send,
-             count_send * sizeof(datatype_send));
+      // the values of AutoPas_MPI_Datatype are the sizes of the types in bytes
+      memcpy(static_cast<char *>(buffer_recv) + (i * count_send * datatype_send), buffer_send,
+             count_send * datatype_send);
   }
   return AUTOPAS_MPI_SUCCESS;
 }
@@ -931,6 +954,13 @@ inline int AutoPas_MPI_Allgather(void *buffer_send, int count_send, AutoPas_MPI_
   return AutoPas_MPI_Gather(buffer_send, count_send, datatype_send, buffer_recv, count_recv, datatype_recv, 0, comm);
 }
 
+inline int AutoPas_MPI_Iallgather(const void *buffer_send, int count_send, AutoPas_MPI_Datatype datatype_send,
+                                  void *buffer_recv, int count_recv, AutoPas_MPI_Datatype datatype_recv,
+                                  AutoPas_MPI_Comm comm, AutoPas_MPI_Request *request) {
+  *request = COMPLETED_REQUEST;
+  return AutoPas_MPI_Gather(buffer_send, count_send, datatype_send, buffer_recv, count_recv, datatype_recv, 0, comm);
+}
+
 inline int AutoPas_MPI_Comm_split(AutoPas_MPI_Comm old_communicator, int color, int key,
                                   AutoPas_MPI_Comm *new_communicator) {
   *new_communicator = old_communicator;
@@ -8,7 +8,8 @@
 
 #include "utils/Timer.h"
 
-autopas::IterationLogger::IterationLogger(const std::string &outputSuffix, bool energyMeasurements)
+autopas::IterationLogger::IterationLogger(const std::string &outputSuffix, bool energyMeasurements,
+                                          bool perfCounterMeasurements)
     : _loggerName("IterationLogger" + outputSuffix) {
 #ifdef AUTOPAS_LOG_ITERATIONS
   const auto *fillerAfterSuffix = outputSuffix.empty() or outputSuffix.back() == '_' ? "" : "_";
@@ -39,7 +40,17 @@ autopas::IterationLogger::IterationLogger(const std::string &outputSuffix, bool
         "energyRam[J],"
         "numFLOPs,"
         "energyPerFLOP[J/#Flops],"
-        "energyDelayProduct[J*ns]");
+        "energyDelayProduct[J*ns],"
+        "meanFrequency[MHz],"
+        "throttleEvents");
+  }
+  if (perfCounterMeasurements) {
+    csvHeader.append(
+        ",instructions,"
+        "cycles,"
+        "IPC,"
+        "l1CacheMisses,"
+        "llcMisses");
   }
   headerLogger->info(csvHeader, Configuration().getCSVHeader());
   spdlog::drop(headerLoggerName);
@@ -63,25 +74,29 @@ void autopas::IterationLogger::logIteration(const autopas::Configuration &config
                                             const IterationMeasurements &measurements, long numFLOPs) const {
 #ifdef AUTOPAS_LOG_ITERATIONS
   const auto &[timeIteratePairwise, timeRemainderTraversal, timeRebuild, timeTotal, energyMeasurementsPossible,
-               energyPsys, energyPkg, energyRam, energyTotal, numFLOP, energyPerFLOP, energyDelayProduct] = measurements;
+               energyPsys, energyPkg, energyRam, energyTotal, numFLOP, energyPerFLOP, energyDelayProduct, meanFrequency,
+               throttleEvents, perfCountersPossible, instructions, cycles, l1CacheMisses, llcMisses] = measurements;
 
   //double energyPerFlop = 0.0;
   //const auto energyDelayProduct = 0.0;
 
+  std::string energyColumns{};
   if (energyMeasurementsPossible) {
     // Calculate EnergyPerFlop and EnergyDelayProduct
     //energyPerFLOP = static_cast<double>(energyTotal) / numFLOPs;
     //energyDelayProduct = static_cast<double>(energyTotal) * timeTotal;
 
-    spdlog::get(_loggerName)
-        ->info("{},{},{},{},{},{},{},{},{},{},{},{},{},{},{}", iteration, functorName, inTuningPhase ? "true" : "false",
-               configuration.getCSVLine(), timeIteratePairwise, timeRemainderTraversal, timeRebuild, timeTotal,
-               timeTuning, energyPsys, energyPkg, energyRam, numFLOPs, energyPerFLOP, energyDelayProduct);
-  } else {
-    spdlog::get(_loggerName)
-        ->info("{},{},{},{},{},{},{},{},{}", iteration, functorName, inTuningPhase ? "true" : "false",
-               configuration.getCSVLine(), timeIteratePairwise, timeRemainderTraversal, timeRebuild, timeTotal,
-               timeTuning);
+    energyColumns = fmt::format(",{},{},{},{},{},{},{},{}", energyPsys, energyPkg, energyRam, numFLOPs, energyPerFLOP,
+                                energyDelayProduct, meanFrequency, throttleEvents);
+  }
+  std::string perfCounterColumns{};
+  if (perfCountersPossible) {
+    const auto ipc = cycles > 0 ? static_cast<double>(instructions) / static_cast<double>(cycles) : 0.;
+    perfCounterColumns = fmt::format(",{},{},{},{},{}", instructions, cycles, ipc, l1CacheMisses, llcMisses);
   }
+  spdlog::get(_loggerName)
+      ->info("{},{},{},{},{},{},{},{},{}{}{}", iteration, functorName, inTuningPhase ? "true" : "false",
+             configuration.getCSVLine(), timeIteratePairwise, timeRemainderTraversal, timeRebuild, timeTotal,
+             timeTuning, energyColumns, perfCounterColumns);
 #endif
 }
@@ -27,8 +27,10 @@ class IterationLogger {
    * Constructor initializes the logger and sets the output file name.
    * @param outputSuffix Suffix for all output files produced by this class.
    * @param energyMeasurements Should the logger include energy measurements?
+   * @param perfCounterMeasurements Should the logger include hardware counter measurements?
    */
-  explicit IterationLogger(const std::string &outputSuffix = "", bool energyMeasurements = false);
+  explicit IterationLogger(const std::string &outputSuffix = "", bool energyMeasurements = false,
+                           bool perfCounterMeasurements = false);
 
   /**
    * Destructor drops the logger from the spd registry.
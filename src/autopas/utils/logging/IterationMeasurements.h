@@ -72,6 +72,45 @@ struct IterationMeasurements {
  */
   long energyDelayProduct{};
 
+  /**
+   * Mean CPU frequency in MHz.
+   */
+  double meanFrequency{};
+
+  /**
+   * Number of thermal throttling events.
+   */
+  long throttleEvents{};
+
+  /**
+   * Total energy normalized to the reference frequency of the CPUs. This is only used to tune for
+   * energyBoundedSlowdown. See AutoTuner::sampleEnergy().
+   */
+  long energyTotalNormalized{};
+
+  /**
+   * Bool whether hardware counter measurements are currently possible.
+   */
+  bool perfCountersPossible{false};
 
+  /**
+   * Number of retired instructions.
+   */
+  long instructions{};
+
+  /**
+   * Number of CPU cycles.
+   */
+  long cycles{};
+
+  /**
+   * Number of L1 data cache read misses.
+   */
+  long l1CacheMisses{};
+
+  /**
+   * Number of last level cache misses.
+   */
+  long llcMisses{};
 };
 }  // namespace autopas
@@ -94,3 +94,51 @@ TEST_F(MPIParallelizedStrategyTest, testDistributeTwoBucket) {
   };
   testBucketDistribution(homogeneities, expectedNumLocalConfig, searchSpace);
 }
+
+/**
+ * With evidence sharing, every rank tests only its part of the search space but all ranks know all evidence at the end
+ * and choose the same optimum. The search space size is not divisible by the number of ranks, so the rank with fewer
+ * configurations has to be kept in the tuning phase.
+ */
+TEST_F(MPIParallelizedStrategyTest, testShareEvidence) {
+  int numRanks{};
+  autopas::AutoPas_MPI_Comm_size(AUTOPAS_MPI_COMM_WORLD, &numRanks);
+  ASSERT_EQ(numRanks, numRanksExpected) << "This test expects there to be three communicating MPI ranks!";
+
+  const std::set<autopas::Configuration> searchSpace{
+      lc_c01_aos, lc_c04_aos, lc_c08_aos, lc_c01_soa, lc_c04_soa,
+  };
+  const autopas::TuningStrategyFactoryInfo factoryInfo{
+      .mpiDivideAndConquer = true,
+      .mpiTuningMaxDifferenceForBucket = 0.3,
+      .mpiTuningShareEvidence = true,
+      .autopasMpiCommunicator = AUTOPAS_MPI_COMM_WORLD,
+  };
+  autopas::AutoTuner::TuningStrategiesListType tuningStrategies{};
+  tuningStrategies.push_back(autopas::TuningStrategyFactory::generateTuningStrategy(
+      searchSpace, autopas::TuningStrategyOption::mpiDivideAndConquer, factoryInfo, ""));
+  const autopas::AutoTunerInfo tunerInfo{.maxSamples = 1};
+  autopas::AutoTuner autoTuner(tuningStrategies, searchSpace, tunerInfo, 10, "");
+
+  autoTuner.addHomogeneityAndMaxDensity(1., 1., 0);
+  autoTuner.forceRetune();
+  // One iteration for the local configurations, one for stretching, one for the shared optimum.
+  size_t numTuningIterations{0};
+  for (bool stillTuning = true; stillTuning and numTuningIterations < 10;) {
+    autoTuner.prepareIteration();
+    const auto [config, tuning] = autoTuner.getNextConfig();
+    stillTuning = tuning;
+    if (stillTuning) {
+      autoTuner.addMeasurement(config == lc_c04_soa ? 10 : 100, true);
+      ++numTuningIterations;
+    }
+    autoTuner.bumpIterationCounters();
+  }
+
+  EXPECT_EQ(numTuningIterations, 3);
+  EXPECT_EQ(autoTuner.getCurrentConfig(), lc_c04_soa);
+  const auto *strategy =
+      dynamic_cast<autopas::MPIParallelizedStrategy *>(autoTuner.getTuningStrategies().front().get());
+  EXPECT_EQ(strategy->getBucketEvidence().size(), searchSpace.size())
+      << "Every rank should know the evidence of the whole search space.";
+}
@@ -670,3 +670,137 @@ using ::testing::ValuesIn;
 INSTANTIATE_TEST_SUITE_P(Generated, AutoPasInterface2ContainersTest,
                          Combine(ValuesIn(getTestableContainerOptions()), ValuesIn(getTestableContainerOptions())),
                          AutoPasInterface2ContainersTest::PrintToStringParamName());
+
+/////////////////////////////////////// TUNING ON SUBDOMAINS ////////////////////////////////////////
+
+/**
+ * Tune while candidate configurations are only timed on a subdomain. The forces of every step have to match those of
+ * a reference without tuning and the container may not change before the tuning phase is over.
+ */
+TEST(AutoPasSubdomainTuningTest, testForcesWhileTuningOnSubdomain) {
+  autopas::AutoPas<Molecule> autoPasTuning;
+  autoPasTuning.setOutputSuffix("tuning_");
+  autoPasTuning.setAllowedContainers({autopas::ContainerOption::linkedCells, autopas::ContainerOption::verletLists});
+  autoPasTuning.setAllowedTraversals({autopas::TraversalOption::lc_c08, autopas::TraversalOption::vl_list_iteration});
+  autoPasTuning.setTuningSubdomainFraction(0.2);
+  autopas::AutoPas<Molecule> autoPasReference;
+  autoPasReference.setOutputSuffix("reference_");
+  autoPasReference.setAllowedContainers({autopas::ContainerOption::linkedCells});
+  autoPasReference.setAllowedTraversals({autopas::TraversalOption::lc_c08});
+  for (auto *aP : {&autoPasTuning, &autoPasReference}) {
+    aP->setAllowedDataLayouts({autopas::DataLayoutOption::aos});
+    aP->setAllowedNewton3Options({autopas::Newton3Option::disabled});
+    defaultInit(*aP);
+  }
+
+  // regular grid of particles with slightly perturbed positions so not all forces are equal
+  size_t id = 0;
+  for (double x = 0.5; x < boxMax[0]; x += 1.) {
+    for (double y = 0.5; y < boxMax[1]; y += 1.) {
+      for (double z = 0.5; z < boxMax[2]; z += 1.) {
+        const Molecule particle({x + 0.01 * static_cast<double>(id % 7), y, z}, zeroArr, id++);
+        autoPasTuning.addParticle(particle);
+        autoPasReference.addParticle(particle);
+      }
+    }
+  }
+
+  LJFunctorGlobals functor(cutoff);
+  functor.setParticleProperties(24.0, 1);
+
+  // two configurations with three samples each
+  constexpr size_t numTuningIterations = 2 * 3;
+  unsigned long containerDuringTuning{};
+  for (size_t iteration = 0; iteration < numTuningIterations + 2; ++iteration) {
+    std::vector<std::array<double, 3>> forcesReference(id);
+    for (auto *aP : {&autoPasTuning, &autoPasReference}) {
+      EXPECT_TRUE(aP->updateContainer().empty());
+      aP->computeInteractions(&functor);
+    }
+    for (auto iter = autoPasReference.begin(autopas::IteratorBehavior::owned); iter.isValid(); ++iter) {
+      forcesReference[iter->getID()] = iter->getF();
+      iter->setF(zeroArr);
+    }
+    for (auto iter = autoPasTuning.begin(autopas::IteratorBehavior::owned); iter.isValid(); ++iter) {
+      for (size_t dim = 0; dim < 3; ++dim) {
+        EXPECT_NEAR(iter->getF()[dim], forcesReference[iter->getID()][dim], 1e-12)
+            << "Iteration " << iteration << " Particle " << iter->getID();
+      }
+      iter->setF(zeroArr);
+    }
+
+    if (iteration == 0) {
+      containerDuringTuning = autoPasTuning.getContainerType();
+    } else if (iteration < numTuningIterations) {
+      EXPECT_EQ(autoPasTuning.getContainerType(), containerDuringTuning) << "Iteration " << iteration;
+    }
+  }
+}
+
+/////////////////////////////////////// TUNING WITH THREAD TEAMS ////////////////////////////////////////
+
+/**
+ * Tune while a second thread team samples a later candidate configuration on a copy of the container. The forces of
+ * every step have to match those of a reference without tuning. The speculative step takes one extra iteration and the
+ * speculative sample can only shorten the tuning phase by skipping the second configuration.
+ */
+TEST(AutoPasThreadTeamTuningTest, testForcesWhileTuningWithThreadTeams) {
+  autopas::AutoPas<Molecule> autoPasTuning;
+  autoPasTuning.setOutputSuffix("tuning_");
+  autoPasTuning.setAllowedContainers({autopas::ContainerOption::linkedCells, autopas::ContainerOption::verletLists});
+  autoPasTuning.setAllowedTraversals({autopas::TraversalOption::lc_c08, autopas::TraversalOption::vl_list_iteration});
+  autoPasTuning.setTuningThreadTeams(true);
+  autoPasTuning.setEarlyStoppingFactor(1.5);
+  autopas::AutoPas<Molecule> autoPasReference;
+  autoPasReference.setOutputSuffix("reference_");
+  autoPasReference.setAllowedContainers({autopas::ContainerOption::linkedCells});
+  autoPasReference.setAllowedTraversals({autopas::TraversalOption::lc_c08});
+  for (auto *aP : {&autoPasTuning, &autoPasReference}) {
+    aP->setAllowedDataLayouts({autopas::DataLayoutOption::aos});
+    aP->setAllowedNewton3Options({autopas::Newton3Option::disabled});
+    defaultInit(*aP);
+  }
+
+  // regular grid of particles with slightly perturbed positions so not all forces are equal
+  size_t id = 0;
+  for (double x = 0.5; x < boxMax[0]; x += 1.) {
+    for (double y = 0.5; y < boxMax[1]; y += 1.) {
+      for (double z = 0.5; z < boxMax[2]; z += 1.) {
+        const Molecule particle({x + 0.01 * static_cast<double>(id % 7), y, z}, zeroArr, id++);
+        autoPasTuning.addParticle(particle);
+        autoPasReference.addParticle(particle);
+      }
+    }
+  }
+
+  LJFunctorGlobals functor(cutoff);
+  functor.setParticleProperties(24.0, 1);
+
+  // two configurations with three samples each, plus the speculative step if there are two thread teams
+  constexpr size_t numSamples = 3;
+  const size_t maxTuningIterations = autopas::autopas_get_max_threads() >= 2 ? 2 * numSamples + 1 : 2 * numSamples;
+  for (size_t iteration = 0; iteration < maxTuningIterations + 2; ++iteration) {
+    std::vector<std::array<double, 3>> forcesReference(id);
+    EXPECT_TRUE(autoPasReference.updateContainer().empty());
+    autoPasReference.computeInteractions(&functor);
+    EXPECT_TRUE(autoPasTuning.updateContainer().empty());
+    const auto stillTuning = autoPasTuning.computeInteractions(&functor);
+    if (iteration == 0) {
+      EXPECT_TRUE(stillTuning);
+    } else if (iteration >= maxTuningIterations) {
+      EXPECT_FALSE(stillTuning) << "Iteration " << iteration;
+    }
+
+    for (auto iter = autoPasReference.begin(autopas::IteratorBehavior::owned); iter.isValid(); ++iter) {
+      forcesReference[iter->getID()] = iter->getF();
+      iter->setF(zeroArr);
+    }
+    for (auto iter = autoPasTuning.begin(autopas::IteratorBehavior::owned); iter.isValid(); ++iter) {
+      for (size_t dim = 0; dim < 3; ++dim) {
+        EXPECT_NEAR(iter->getF()[dim], forcesReference[iter->getID()][dim], 1e-12)
+            << "Iteration " << iteration << " Particle " << iter->getID();
+      }
+      iter->setF(zeroArr);
+    }
+  }
+}
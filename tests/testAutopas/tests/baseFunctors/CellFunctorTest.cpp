@@ -314,6 +314,79 @@ TYPED_TEST_P(CellFunctorTest, testOwnedAndHaloCellInteractionSingle) {
   }
 }
 
-REGISTER_TYPED_TEST_SUITE_P(CellFunctorTest, testOwnedAndHaloCellInteractionPair,
-                            testOwnedAndHaloCellInteractionSingle);
+/**
+ * Tests that processing a cell pair with sorted SoA windows yields the same forces as processing it without sorting.
+ * The particles are placed so that only a part of each cell lies within the cutoff of the other cell.
+ */
+TYPED_TEST_P(CellFunctorTest, testSortedSoAWindows) {
+  using CellFunctorType = TypeParam;
+
+  constexpr double cutoff = 0.3;
+  constexpr double sigma = 0.1;
+  constexpr double epsilon = 1.;
+  constexpr size_t numParticlesPerCell = 50;
+
+  // two neighboring cells along x with random particles. ids of cell2 continue after cell1.
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0., 1.);
+  autopas::FullParticleCell<Molecule> cell1Template({1., 1., 1.});
+  autopas::FullParticleCell<Molecule> cell2Template({1., 1., 1.});
+  for (size_t i = 0; i < numParticlesPerCell; ++i) {
+    cell1Template.addParticle(
+        Molecule({distribution(generator), distribution(generator), distribution(generator)}, {0., 0., 0.}, i));
+    cell2Template.addParticle(Molecule(
+        {1. + distribution(generator), distribution(generator), distribution(generator)}, {0., 0., 0.},
+        numParticlesPerCell + i));
+  }
+
+  // calculate forces with and without sorted windows and collect them by particle id
+  const auto calculateForces = [&](bool useSortedSoAWindows) {
+    // both variants work on sorted cells so that only the windows make a difference
+    auto cell1 = cell1Template;
+    auto cell2 = cell2Template;
+    cell1.sortByDim(autopas::sortedSoAWindowDimension(cell1.getCellLength()));
+    cell2.sortByDim(autopas::sortedSoAWindowDimension(cell2.getCellLength()));
+
+    LJFunctorType<> ljFunctor(cutoff);
+    ljFunctor.setParticleProperties(epsilon * 24., sigma * sigma);
+    ljFunctor.initTraversal();
+
+    CellFunctorType cellFunctor(&ljFunctor, cutoff);
+    cellFunctor.setSortingThreshold(0);
+    cellFunctor.setUseSortedSoAWindows(useSortedSoAWindows);
+
+    if (cellFunctor.getDataLayout() == autopas::DataLayoutOption::soa) {
+      ljFunctor.SoALoader(cell1, cell1._particleSoABuffer, 0, /*skipSoAResize*/ false);
+      ljFunctor.SoALoader(cell2, cell2._particleSoABuffer, 0, /*skipSoAResize*/ false);
+    }
+    cellFunctor.processCellPair(cell1, cell2, {1., 0., 0.});
+    if (cellFunctor.getDataLayout() == autopas::DataLayoutOption::soa) {
+      ljFunctor.SoAExtractor(cell1, cell1._particleSoABuffer, 0);
+      ljFunctor.SoAExtractor(cell2, cell2._particleSoABuffer, 0);
+    }
+    ljFunctor.endTraversal(cellFunctor.getNewton3());
+
+    std::vector<std::array<double, 3>> forces(2 * numParticlesPerCell);
+    for (const auto &cell : {cell1, cell2}) {
+      for (const auto &p : cell) {
+        forces[p.getID()] = p.getF();
+      }
+    }
+    return forces;
+  };
+
+  const auto forcesReference = calculateForces(false);
+  const auto forcesSortedWindows = calculateForces(true);
+
+  for (size_t id = 0; id < forcesReference.size(); ++id) {
+    for (size_t d = 0; d < 3; ++d) {
+      EXPECT_NEAR(forcesReference[id][d], forcesSortedWindows[id][d],
+                  1e-12 * std::max(1., std::abs(forcesReference[id][d])))
+          << "Particle " << id << " dim " << d;
+    }
+  }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(CellFunctorTest, testOwnedAndHaloCellInteractionPair, testOwnedAndHaloCellInteractionSingle,
+                            testSortedSoAWindows);
 INSTANTIATE_TYPED_TEST_SUITE_P(TypedTest, CellFunctorTest, CellFTestingTypes);
\ No newline at end of file
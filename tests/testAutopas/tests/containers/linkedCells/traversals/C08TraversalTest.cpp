@@ -6,4 +6,101 @@
 
 #include "C08TraversalTest.h"
 
+#include <algorithm>
+#include <random>
+
+#include "autopas/containers/linkedCells/traversals/LCC08Traversal.h"
+#include "autopas/utils/ThreeDimensionalMapping.h"
+#include "molecularDynamicsLibrary/LJFunctor.h"
+#include "testingHelpers/commonTypedefs.h"
+
 // Place to implement special test cases, which only apply to C08 Traversal
+
+/**
+ * Checks that sorted SoA windows only sort cells that can be part of a cell pair above the sorting threshold and that
+ * the forces are the same as without sorted SoA windows.
+ */
+TEST_F(C08TraversalTest, testSortedSoAWindowsOnlySortLargeCells) {
+  const std::array<unsigned long, 3> cellsPerDimension{4, 4, 4};
+  const std::array<double, 3> cellLength{1., 1., 1.};
+  constexpr double cutoff = 1.;
+  constexpr size_t numParticlesDenseCell = 20;
+  constexpr size_t numParticlesSparseCell = 3;
+  // cells with at least 25 - 20 + 1 = 6 particles have to be sorted
+  constexpr size_t sortingThreshold = 25;
+
+  // Two dense cells along y, whose pair is processed with windows, and a sparse cell next to the first one along x.
+  // The particles of all cells are stored in descending order along x, which is the sorting dimension.
+  using autopas::utils::ThreeDimensionalMapping::threeToOneD;
+  const auto denseCellIndex = threeToOneD(1ul, 1ul, 1ul, cellsPerDimension);
+  const auto secondDenseCellIndex = threeToOneD(1ul, 2ul, 1ul, cellsPerDimension);
+  const auto sparseCellIndex = threeToOneD(2ul, 1ul, 1ul, cellsPerDimension);
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0., 1.);
+  std::vector<FMCell> cellsTemplate(cellsPerDimension[0] * cellsPerDimension[1] * cellsPerDimension[2],
+                                    FMCell(cellLength));
+  const auto fillCell = [&](FMCell &cell, const std::array<double, 3> &cellOrigin, size_t numParticles,
+                            size_t firstId) {
+    std::vector<Molecule> particles;
+    for (size_t i = 0; i < numParticles; ++i) {
+      particles.emplace_back(
+          std::array<double, 3>{cellOrigin[0] + distribution(generator), cellOrigin[1] + distribution(generator),
+                                cellOrigin[2] + distribution(generator)},
+          std::array<double, 3>{0., 0., 0.}, firstId + i);
+    }
+    std::sort(particles.begin(), particles.end(),
+              [](const auto &a, const auto &b) { return a.getR()[0] > b.getR()[0]; });
+    for (const auto &particle : particles) {
+      cell.addParticle(particle);
+    }
+  };
+  fillCell(cellsTemplate[denseCellIndex], {1., 1., 1.}, numParticlesDenseCell, 0);
+  fillCell(cellsTemplate[secondDenseCellIndex], {1., 2., 1.}, numParticlesDenseCell, numParticlesDenseCell);
+  fillCell(cellsTemplate[sparseCellIndex], {2., 1., 1.}, numParticlesSparseCell, 2 * numParticlesDenseCell);
+
+  const auto traverse = [&](std::vector<FMCell> &cells, bool useSortedSoAWindows) {
+    LJFunctorType<> ljFunctor(cutoff);
+    ljFunctor.setParticleProperties(24., 0.01);
+    autopas::LCC08Traversal<FMCell, LJFunctorType<>> traversal(cellsPerDimension, &ljFunctor, cutoff, cellLength,
+                                                               autopas::DataLayoutOption::soa, true);
+    traversal.setSortingThreshold(sortingThreshold);
+    traversal.setUseSortedSoAWindows(useSortedSoAWindows);
+    traversal.setCellsToTraverse(cells);
+    ljFunctor.initTraversal();
+    traversal.initTraversal();
+    traversal.traverseParticles();
+    traversal.endTraversal();
+    ljFunctor.endTraversal(true);
+
+    std::vector<std::array<double, 3>> forces(2 * numParticlesDenseCell + numParticlesSparseCell);
+    for (const auto &cell : cells) {
+      for (const auto &p : cell) {
+        forces[p.getID()] = p.getF();
+      }
+    }
+    return forces;
+  };
+  const auto isSortedAlongX = [](const FMCell &cell) {
+    return std::is_sorted(cell.begin(), cell.end(),
+                          [](const auto &a, const auto &b) { return a.getR()[0] < b.getR()[0]; });
+  };
+
+  auto cellsReference = cellsTemplate;
+  const auto forcesReference = traverse(cellsReference, false);
+  EXPECT_FALSE(isSortedAlongX(cellsReference[denseCellIndex])) << "Cells must not be sorted without sorted windows.";
+
+  auto cellsSortedWindows = cellsTemplate;
+  const auto forcesSortedWindows = traverse(cellsSortedWindows, true);
+  EXPECT_TRUE(isSortedAlongX(cellsSortedWindows[denseCellIndex]));
+  EXPECT_TRUE(isSortedAlongX(cellsSortedWindows[secondDenseCellIndex]));
+  EXPECT_FALSE(isSortedAlongX(cellsSortedWindows[sparseCellIndex]))
+      << "The sparse cell can not be part of a pair above the sorting threshold, so it must not be sorted.";
+
+  for (size_t id = 0; id < forcesReference.size(); ++id) {
+    for (size_t d = 0; d < 3; ++d) {
+      EXPECT_NEAR(forcesReference[id][d], forcesSortedWindows[id][d],
+                  1e-12 * std::max(1., std::abs(forcesReference[id][d])))
+          << "Particle " << id << " dim " << d;
+    }
+  }
+}
@@ -137,3 +137,45 @@ TEST_F(VerletListsCellsTest, testVerletListBuild) {
   soaTest(1.0, autopas::VerletListsCellsHelpers::VLCBuildType::aosBuild);
   soaTest(2.0, autopas::VerletListsCellsHelpers::VLCBuildType::aosBuild);
 }
+
+/**
+ * Rebuilds the lists several times while particles move and checks that the recycled lists do not keep stale entries.
+ */
+TEST_F(VerletListsCellsTest, testVerletListRebuild) {
+  MockPairwiseFunctor<Particle> functor;
+  const double cutoff = 1.;
+  autopas::VerletListsCells<Particle, autopas::VLCAllCellsNeighborList<Particle>> verletLists(
+      {1., 1., 1.}, {3., 3., 3.}, cutoff, 0.01, 20, 1., autopas::LoadEstimatorOption::none,
+      autopas::VerletListsCellsHelpers::VLCBuildType::aosBuild);
+
+  verletLists.addParticle(Particle({2., 2., 2.}, {0., 0., 0.}, 0));
+  verletLists.addParticle(Particle({1.5, 2., 2.}, {0., 0., 0.}, 1));
+
+  autopas::VLCC18Traversal<FPCell, MPairwiseFunctor, autopas::VLCAllCellsNeighborList<Particle>> traversal(
+      verletLists.getCellsPerDimension(), &functor, verletLists.getInteractionLength(), verletLists.getCellLength(),
+      autopas::DataLayoutOption::aos, true, autopas::ContainerOption::verletListsCells);
+
+  const auto countPartners = [&]() {
+    size_t partners = 0;
+    for (auto iter = verletLists.begin(autopas::IteratorBehavior::ownedOrHalo); iter.isValid(); ++iter) {
+      partners += verletLists.getNumberOfPartners(&*iter);
+    }
+    return partners;
+  };
+
+  for (int rebuild = 0; rebuild < 3; ++rebuild) {
+    verletLists.rebuildNeighborLists(&traversal);
+    EXPECT_EQ(countPartners(), 1) << "Rebuild " << rebuild;
+  }
+
+  // move the particles apart so that they are no neighbors anymore
+  for (auto iter = verletLists.begin(autopas::IteratorBehavior::ownedOrHalo); iter.isValid(); ++iter) {
+    if (iter->getID() == 1) {
+      iter->setR({1.01, 1.01, 1.01});
+    } else {
+      iter->setR({2.99, 2.99, 2.99});
+    }
+  }
+  verletLists.rebuildNeighborLists(&traversal);
+  EXPECT_EQ(countPartners(), 0);
+}
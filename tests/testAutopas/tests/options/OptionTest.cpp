@@ -98,6 +98,8 @@ TEST(OptionTest, parseTuningStrategyOptionsTest) {
       {autopas::TuningStrategyOption::slowConfigFilter, "slow-filter"},
       {autopas::TuningStrategyOption::sortByName, "sortbyname"},
       {autopas::TuningStrategyOption::tuningStrategyLogger, "tuningstratLogger"},
+      {autopas::TuningStrategyOption::tuningDatabase, "database"},
+      {autopas::TuningStrategyOption::regressionCostModel, "regression"},
   };
 
   EXPECT_EQ(mapEnumString.size(), autopas::TuningStrategyOption::getOptionNames().size());
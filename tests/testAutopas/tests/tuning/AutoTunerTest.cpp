@@ -7,6 +7,8 @@
 #include "AutoTunerTest.h"
 
 #include <cstddef>
+#include <map>
+#include <set>
 #include <vector>
 
 #include "autopas/LogicHandler.h"
@@ -21,6 +23,7 @@
 #include "autopas/tuning/utils/SearchSpaceGenerators.h"
 #include "autopas/utils/checkFunctorType.h"
 #include "autopasTools/generators/GridGenerator.h"
+#include "testingHelpers/NumThreadGuard.h"
 #include "testingHelpers/commonTypedefs.h"
 
 /**
@@ -857,6 +860,316 @@ TEST_F(AutoTunerTest, testSampleWeightingTwoRebuild) {
   EXPECT_EQ(expectedEvidence, autoTuner.getEvidenceCollection().getEvidence(config)->front().value);
 }
 
+/**
+ * Check that a configuration whose amortized estimate is much slower than the best one of the phase is not sampled
+ * further, that the next configuration still starts with a rebuild, and that an expensive rebuild alone does not stop
+ * the sampling.
+ */
+TEST_F(AutoTunerTest, testEarlyStopping) {
+  autopas::AutoTuner::TuningStrategiesListType tuningStrategies{};
+  autopas::AutoTuner::SearchSpaceType searchSpace{_confLc_c08_noN3, _confLc_c01_noN3, _confLc_c18_noN3};
+  const autopas::AutoTunerInfo autoTunerInfo{
+      .maxSamples = 3,
+      .useLOESSSmoothening = false,
+      .earlyStoppingFactor = 2.,
+  };
+  constexpr size_t rebuildFrequency = 3;
+  autopas::AutoTuner autoTuner{tuningStrategies, searchSpace, autoTunerInfo, rebuildFrequency, ""};
+
+  // fully sample the first configuration
+  const auto [firstConfig, firstStillTuning] = autoTuner.getNextConfig();
+  for (size_t i = 0; i < autoTunerInfo.maxSamples; ++i) {
+    EXPECT_EQ(autoTuner.getNextConfig(), std::make_tuple(firstConfig, true));
+    autoTuner.addMeasurement(10, i == 0);
+    autoTuner.bumpIterationCounters();
+  }
+
+  // The second configuration is more than twice as slow. The rebuild sample alone is not judged, but together with
+  // one sample without rebuild it is enough.
+  const auto [secondConfig, secondStillTuning] = autoTuner.getNextConfig();
+  EXPECT_NE(firstConfig, secondConfig);
+  autoTuner.addMeasurement(100, true);
+  autoTuner.bumpIterationCounters();
+  EXPECT_EQ(autoTuner.getNextConfig(), std::make_tuple(secondConfig, true));
+  autoTuner.addMeasurement(100, false);
+  EXPECT_TRUE(autoTuner.willRebuildNeighborLists()) << "The next configuration should start with a rebuild.";
+  autoTuner.bumpIterationCounters();
+
+  const auto [thirdConfig, thirdStillTuning] = autoTuner.getNextConfig();
+  EXPECT_TRUE(thirdStillTuning);
+  EXPECT_NE(secondConfig, thirdConfig);
+  EXPECT_NE(firstConfig, thirdConfig);
+  const auto *secondEvidence = autoTuner.getEvidenceCollection().getEvidence(secondConfig);
+  ASSERT_NE(secondEvidence, nullptr);
+  ASSERT_EQ(secondEvidence->size(), 1);
+  EXPECT_EQ(secondEvidence->front().value, 100);
+
+  // The rebuild of the third configuration alone exceeds twice the best evidence, but amortized over the rebuild
+  // frequency it is competitive, so it is fully sampled.
+  for (const auto &[sample, rebuilt] : {std::make_pair(50l, true), {1l, false}, {1l, false}}) {
+    EXPECT_EQ(autoTuner.getNextConfig(), std::make_tuple(thirdConfig, true));
+    autoTuner.addMeasurement(sample, rebuilt);
+    autoTuner.bumpIterationCounters();
+  }
+  EXPECT_EQ(autoTuner.getEvidenceCollection().getEvidence(thirdConfig)->front().value, (50 + 2 * 1) / 3);
+}
+
+/**
+ * Check that with adaptive sampling a configuration whose confidence interval lies clearly above the best one is
+ * stopped as soon as it has a sample without rebuild and that a configuration that can not be told apart from the best
+ * one is sampled up to the cap.
+ */
+TEST_F(AutoTunerTest, testAdaptiveSampling) {
+  autopas::AutoTuner::TuningStrategiesListType tuningStrategies{};
+  autopas::AutoTuner::SearchSpaceType searchSpace{_confLc_c08_noN3, _confLc_c01_noN3, _confLc_c18_noN3};
+  const autopas::AutoTunerInfo autoTunerInfo{
+      .maxSamples = 3,
+      .useLOESSSmoothening = false,
+      .maxAdaptiveSamples = 6,
+  };
+  constexpr size_t rebuildFrequency = 3;
+  autopas::AutoTuner autoTuner{tuningStrategies, searchSpace, autoTunerInfo, rebuildFrequency, ""};
+
+  // the first configuration has nothing to be compared to, so it gets exactly maxSamples samples
+  const auto [firstConfig, firstStillTuning] = autoTuner.getNextConfig();
+  for (const auto &[sample, rebuilt] : {std::make_pair(100l, true), {99l, false}, {101l, false}}) {
+    EXPECT_EQ(autoTuner.getNextConfig(), std::make_tuple(firstConfig, true));
+    autoTuner.addMeasurement(sample, rebuilt);
+    autoTuner.bumpIterationCounters();
+  }
+  const auto &firstEvidence = autoTuner.getEvidenceCollection().getEvidence(firstConfig)->front();
+  // the default selector strategy uses the fastest sample of each kind
+  EXPECT_EQ(firstEvidence.value, (100 + 2 * 99) / 3);
+  EXPECT_EQ(firstEvidence.numSamples, 2);
+  EXPECT_GT(firstEvidence.variance, 0.);
+
+  // The second configuration is twice as slow, which is far outside of the confidence interval of the first one. A
+  // slow rebuild alone could still be amortized, so it is only stopped after a sample without rebuild.
+  const auto [secondConfig, secondStillTuning] = autoTuner.getNextConfig();
+  EXPECT_NE(firstConfig, secondConfig);
+  autoTuner.addMeasurement(200, true);
+  autoTuner.bumpIterationCounters();
+  EXPECT_EQ(autoTuner.getEvidenceCollection().getEvidence(secondConfig), nullptr);
+  EXPECT_EQ(autoTuner.getNextConfig(), std::make_tuple(secondConfig, true));
+  autoTuner.addMeasurement(200, false);
+  EXPECT_TRUE(autoTuner.willRebuildNeighborLists()) << "The next configuration should start with a rebuild.";
+  autoTuner.bumpIterationCounters();
+  EXPECT_EQ(autoTuner.getEvidenceCollection().getEvidence(secondConfig)->size(), 1);
+
+  // the third configuration is as fast as the first one but noisier, so its interval never separates from the best one
+  const auto [thirdConfig, thirdStillTuning] = autoTuner.getNextConfig();
+  EXPECT_TRUE(thirdStillTuning);
+  size_t numThirdSamples = 0;
+  while (autoTuner.getNextConfig() == std::make_tuple(thirdConfig, true)) {
+    const bool rebuilt = numThirdSamples % rebuildFrequency == 0;
+    autoTuner.addMeasurement(rebuilt ? 100 : (numThirdSamples % 2 == 0 ? 95 : 105), rebuilt);
+    autoTuner.bumpIterationCounters();
+    ++numThirdSamples;
+  }
+  EXPECT_EQ(numThirdSamples, autoTunerInfo.maxAdaptiveSamples);
+  EXPECT_EQ(autoTuner.getEvidenceCollection().getEvidence(thirdConfig)->front().numSamples, 6);
+  EXPECT_FALSE(autoTuner.inTuningPhase());
+}
+
+/**
+ * Check that continuous tuning interleaves a single exploration step after the first tuning phase, adopts the explored
+ * configuration if it is faster, and starts a full tuning phase when the runtime of the selected configuration drifts.
+ */
+TEST_F(AutoTunerTest, testContinuousTuning) {
+  autopas::AutoTuner::TuningStrategiesListType tuningStrategies{};
+  autopas::AutoTuner::SearchSpaceType searchSpace{_confLc_c08_noN3, _confLc_c01_noN3, _confLc_c18_noN3};
+  const autopas::AutoTunerInfo autoTunerInfo{
+      .tuningInterval = 10,
+      .maxSamples = 1,
+      .useLOESSSmoothening = false,
+      .explorationInterval = 5,
+      .driftThreshold = 0.5,
+  };
+  constexpr size_t rebuildFrequency = 3;
+  autopas::AutoTuner autoTuner{tuningStrategies, searchSpace, autoTunerInfo, rebuildFrequency, ""};
+
+  // first tuning phase: configurations are 10, 20, and 30 units fast in the order they are tested
+  std::vector<autopas::Configuration> testedConfigs;
+  for (const long sample : {10, 20, 30}) {
+    const auto [config, stillTuning] = autoTuner.getNextConfig();
+    EXPECT_TRUE(stillTuning);
+    testedConfigs.push_back(config);
+    autoTuner.addMeasurement(sample, true);
+    autoTuner.bumpIterationCounters();
+  }
+
+  // exploit the best configuration until the exploration step is due
+  for (size_t i = 0; i < autoTunerInfo.explorationInterval; ++i) {
+    EXPECT_EQ(autoTuner.getNextConfig(), std::make_tuple(testedConfigs[0], false));
+    autoTuner.addNonTuningMeasurement(10, false);
+    autoTuner.bumpIterationCounters();
+  }
+  EXPECT_TRUE(autoTuner.willRebuildNeighborLists()) << "The exploration step should start with a rebuild.";
+
+  // the second best configuration has the highest upper confidence bound and turns out to be faster now
+  EXPECT_EQ(autoTuner.getNextConfig(), std::make_tuple(testedConfigs[1], true));
+  autoTuner.addMeasurement(5, true);
+  autoTuner.bumpIterationCounters();
+
+  // iterations 9 to 11: the tuning interval is ignored, so no new tuning phase starts at iteration 10
+  for (size_t i = 0; i < 3; ++i) {
+    EXPECT_EQ(autoTuner.getNextConfig(), std::make_tuple(testedConfigs[1], false));
+    autoTuner.addNonTuningMeasurement(5, false);
+    autoTuner.bumpIterationCounters();
+  }
+
+  // a runtime drift of the selected configuration starts a full tuning phase
+  EXPECT_EQ(autoTuner.getNextConfig(), std::make_tuple(testedConfigs[1], false));
+  autoTuner.addNonTuningMeasurement(50, false);
+  autoTuner.bumpIterationCounters();
+  EXPECT_TRUE(std::get<1>(autoTuner.getNextConfig()));
+  EXPECT_EQ(autoTuner.getConfigQueue().size(), searchSpace.size());
+}
+
+/**
+ * Check that with retuning on drift the regular tuning phase is postponed while nothing drifts and that a drift of the
+ * particle distribution starts a new tuning phase immediately.
+ */
+TEST_F(AutoTunerTest, testRetuneOnDrift) {
+  autopas::AutoTuner::TuningStrategiesListType tuningStrategies{};
+  autopas::AutoTuner::SearchSpaceType searchSpace{_confLc_c08_noN3, _confLc_c01_noN3};
+  const autopas::AutoTunerInfo autoTunerInfo{
+      .tuningInterval = 10,
+      .maxSamples = 1,
+      .useLOESSSmoothening = false,
+      .retuneOnDrift = true,
+      .scenarioDriftThreshold = 0.3,
+  };
+  constexpr size_t rebuildFrequency = 3;
+  autopas::AutoTuner autoTuner{tuningStrategies, searchSpace, autoTunerInfo, rebuildFrequency, ""};
+
+  // first tuning phase
+  for (const long sample : {10, 20}) {
+    EXPECT_TRUE(std::get<1>(autoTuner.getNextConfig()));
+    autoTuner.addMeasurement(sample, true);
+    autoTuner.bumpIterationCounters();
+  }
+
+  // iterations 2 to 10: nothing drifts, so the tuning phase in iteration 10 is postponed
+  const auto [optimum, optimumStillTuning] = autoTuner.getNextConfig();
+  for (size_t iteration = 2; iteration <= autoTunerInfo.tuningInterval; ++iteration) {
+    EXPECT_EQ(autoTuner.getNextConfig(), std::make_tuple(optimum, false)) << "Iteration " << iteration;
+    EXPECT_FALSE(autoTuner.inTuningPhase()) << "Iteration " << iteration;
+    autoTuner.addScenarioStatistics(0.1, 1.);
+    autoTuner.addNonTuningMeasurement(10, false);
+    autoTuner.bumpIterationCounters();
+  }
+
+  // the maximum density doubles, which starts a new tuning phase in the next iteration
+  EXPECT_EQ(autoTuner.getNextConfig(), std::make_tuple(optimum, false));
+  autoTuner.addScenarioStatistics(0.1, 2.);
+  autoTuner.bumpIterationCounters();
+  EXPECT_TRUE(autoTuner.inTuningPhase());
+  EXPECT_TRUE(std::get<1>(autoTuner.getNextConfig()));
+  EXPECT_EQ(autoTuner.getConfigQueue().size(), searchSpace.size());
+}
+
+/**
+ * Check that samples are amortized over the rebuild frequency of the sampled configuration and not over the default one
+ * and that the rebuild rhythm after tuning follows the selected configuration.
+ */
+TEST_F(AutoTunerTest, testTunedRebuildFrequency) {
+  auto confFrequency2 = _confLc_c08_noN3;
+  confFrequency2.rebuildFrequency = 2;
+  auto confFrequency5 = _confLc_c08_noN3;
+  confFrequency5.rebuildFrequency = 5;
+  autopas::AutoTuner::TuningStrategiesListType tuningStrategies{};
+  autopas::AutoTuner::SearchSpaceType searchSpace{confFrequency2, confFrequency5};
+  const autopas::AutoTunerInfo autoTunerInfo{
+      .maxSamples = 2,
+      .useLOESSSmoothening = false,
+  };
+  constexpr size_t defaultRebuildFrequency = 10;
+  autopas::AutoTuner autoTuner{tuningStrategies, searchSpace, autoTunerInfo, defaultRebuildFrequency, ""};
+
+  // Both configurations take 100 in rebuild iterations and 10 otherwise.
+  for (size_t i = 0; i < searchSpace.size(); ++i) {
+    std::ignore = autoTuner.getNextConfig();
+    autoTuner.addMeasurement(100, true);
+    autoTuner.bumpIterationCounters();
+    std::ignore = autoTuner.getNextConfig();
+    autoTuner.addMeasurement(10, false);
+    autoTuner.bumpIterationCounters();
+  }
+  EXPECT_EQ(autoTuner.getEvidenceCollection().getEvidence(confFrequency2)->front().value, (100 + 1 * 10) / 2);
+  EXPECT_EQ(autoTuner.getEvidenceCollection().getEvidence(confFrequency5)->front().value, (100 + 4 * 10) / 5);
+
+  // the less frequent rebuilds win and define the rebuild rhythm from now on
+  EXPECT_EQ(autoTuner.getNextConfig(), std::make_tuple(confFrequency5, false));
+  for (size_t i = 1; i < confFrequency5.rebuildFrequency; ++i) {
+    EXPECT_FALSE(autoTuner.willRebuildNeighborLists()) << "Iteration " << i << " after tuning";
+    autoTuner.bumpIterationCounters();
+  }
+  EXPECT_TRUE(autoTuner.willRebuildNeighborLists());
+}
+
+/**
+ * Switch between two configurations that only differ in their rebuild frequency and check that the container always
+ * has the skin of the active configuration and that lists are rebuilt in the rhythm of the selected configuration.
+ */
+TEST_F(AutoTunerTest, testRebuildFrequencySwitchUpdatesContainer) {
+  using namespace autopas;
+  auto confFrequency2 = _confLc_c08_N3;
+  confFrequency2.rebuildFrequency = 2;
+  auto confFrequency4 = _confLc_c08_N3;
+  confFrequency4.rebuildFrequency = 4;
+  constexpr unsigned int defaultRebuildFrequency = 4;
+  const LogicHandlerInfo logicHandlerInfo{
+      .boxMin{0., 0., 0.},
+      .boxMax{10., 10., 10.},
+      .verletSkinPerTimestep = 0.1,
+  };
+  const AutoTunerInfo autoTunerInfo{
+      .maxSamples = 2,
+      .useLOESSSmoothening = false,
+  };
+  AutoTuner::TuningStrategiesListType tuningStrategies{};
+  std::unordered_map<InteractionTypeOption::Value, std::unique_ptr<AutoTuner>> tunerMap;
+  const AutoTuner::SearchSpaceType searchSpace{confFrequency2, confFrequency4};
+  tunerMap.emplace(
+      InteractionTypeOption::pairwise,
+      std::make_unique<AutoTuner>(tuningStrategies, searchSpace, autoTunerInfo, defaultRebuildFrequency, ""));
+  auto &autoTuner = *tunerMap[InteractionTypeOption::pairwise];
+  LogicHandler<Molecule> logicHandler(tunerMap, logicHandlerInfo, defaultRebuildFrequency, "");
+  logicHandler.getContainer().addParticle(Molecule{{1., 1., 1.}, {0., 0., 0.}, 0, 0});
+  logicHandler.getContainer().addParticle(Molecule{{1.5, 1., 1.}, {0., 0., 0.}, 1, 0});
+
+  testing::NiceMock<MockPairwiseFunctor<Molecule>> functor;
+  EXPECT_CALL(functor, isRelevantForTuning()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(functor, allowsNewton3()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(functor, allowsNonNewton3()).WillRepeatedly(::testing::Return(true));
+
+  std::set<unsigned int> usedFrequencies{};
+  std::vector<size_t> rebuildIterationsAfterTuning{};
+  for (size_t iteration = 0; iteration < 30; ++iteration) {
+    const bool wasTuning = autoTuner.inTuningPhase();
+    auto dummyParticlesVec = logicHandler.updateContainer();
+    // The step counter is reset to zero and then incremented in iterations that rebuild the lists.
+    const bool rebuilds = logicHandler.getContainer().getStepsSinceLastRebuild() == 1;
+    logicHandler.computeInteractionsPipeline(&functor, InteractionTypeOption::pairwise);
+
+    const auto frequency = autoTuner.getCurrentConfig().rebuildFrequency;
+    usedFrequencies.insert(frequency);
+    EXPECT_DOUBLE_EQ(logicHandler.getContainer().getVerletSkin(), logicHandlerInfo.verletSkinPerTimestep * frequency)
+        << "Iteration " << iteration;
+    if (not wasTuning and rebuilds) {
+      rebuildIterationsAfterTuning.push_back(iteration);
+    }
+  }
+
+  EXPECT_EQ(usedFrequencies, (std::set<unsigned int>{2, 4}));
+  ASSERT_GE(rebuildIterationsAfterTuning.size(), 3);
+  const auto selectedFrequency = autoTuner.getCurrentConfig().rebuildFrequency;
+  for (size_t i = 1; i < rebuildIterationsAfterTuning.size(); ++i) {
+    EXPECT_EQ(rebuildIterationsAfterTuning[i] - rebuildIterationsAfterTuning[i - 1], selectedFrequency);
+  }
+}
+
 /**
  * Test that if a tuning strategy wipes the whole config queue it is not applied.
  */
@@ -893,6 +1206,78 @@ TEST_F(AutoTunerTest, testRestoreAfterWipe) {
   EXPECT_EQ(autoTuner.getConfigQueue()[1], _confLc_c08_noN3);
 }
 
+/**
+ * Configurations that are marked as inapplicable are left out when the queue is filled at the start of a tuning phase,
+ * unless no other configuration is left.
+ */
+TEST_F(AutoTunerTest, testInapplicableConfigurationsLeftOut) {
+  autopas::AutoTuner::TuningStrategiesListType tuningStrategies{};
+  const autopas::AutoTuner::SearchSpaceType searchSpace{_confLc_c08_noN3, _confLc_c01_noN3, _confLc_c18_noN3};
+  const autopas::AutoTunerInfo autoTunerInfo{
+      .maxSamples = 1,
+  };
+  constexpr size_t rebuildFrequency = 3;
+
+  autopas::AutoTuner autoTuner{tuningStrategies, searchSpace, autoTunerInfo, rebuildFrequency, ""};
+  autoTuner.setInapplicableConfigurations({_confLc_c18_noN3});
+  const auto iDontCare = autoTuner.getNextConfig();
+  const auto &configQueue = autoTuner.getConfigQueue();
+  EXPECT_EQ(configQueue.size(), searchSpace.size() - 1);
+  EXPECT_EQ(std::count(configQueue.begin(), configQueue.end(), _confLc_c18_noN3), 0);
+
+  autopas::AutoTuner autoTunerNothingApplicable{tuningStrategies, searchSpace, autoTunerInfo, rebuildFrequency, ""};
+  autoTunerNothingApplicable.setInapplicableConfigurations(searchSpace);
+  const auto iDontCareEither = autoTunerNothingApplicable.getNextConfig();
+  EXPECT_EQ(autoTunerNothingApplicable.getConfigQueue().size(), searchSpace.size());
+}
+
+/**
+ * Speculative samples are taken with only a part of the threads, so they must never become evidence. They may only be
+ * used to skip a configuration whose estimate is hopeless compared to the best evidence of the phase. The iteration in
+ * which they are taken is repeated with the same neighbor list rebuild, so the current configuration still gets a
+ * rebuild sample.
+ */
+TEST_F(AutoTunerTest, testSpeculativeSamplesOnlyPrune) {
+  autopas::AutoTuner::TuningStrategiesListType tuningStrategies{};
+  const autopas::AutoTuner::SearchSpaceType searchSpace{_confLc_c08_noN3, _confLc_c01_noN3, _confLc_c18_noN3};
+  const autopas::AutoTunerInfo autoTunerInfo{
+      .maxSamples = 2,
+      .earlyStoppingFactor = 2.,
+  };
+  constexpr size_t rebuildFrequency = 3;
+
+  autopas::AutoTuner autoTuner{tuningStrategies, searchSpace, autoTunerInfo, rebuildFrequency, ""};
+  EXPECT_FALSE(autoTuner.getSpeculativeConfig().has_value()) << "No speculation outside of tuning phases.";
+
+  const auto [firstConf, stillTuning] = autoTuner.getNextConfig();
+  ASSERT_TRUE(stillTuning);
+  const auto speculativeConf = autoTuner.getSpeculativeConfig();
+  ASSERT_TRUE(speculativeConf.has_value());
+  EXPECT_NE(*speculativeConf, firstConf);
+
+  // The speculative configuration takes three times as long as the current one.
+  autoTuner.addSpeculativeMeasurement(*speculativeConf, 300, 100);
+  EXPECT_TRUE(autoTuner.willRebuildNeighborLists()) << "The repeated speculative iteration has to rebuild, too.";
+  autoTuner.bumpIterationCounters();
+  EXPECT_FALSE(autoTuner.getSpeculativeConfig().has_value()) << "Only one speculative sample per configuration.";
+
+  for (size_t i = 0; i < autoTunerInfo.maxSamples; ++i) {
+    const auto [conf, stillTuningSample] = autoTuner.getNextConfig();
+    EXPECT_EQ(conf, firstConf);
+    autoTuner.addMeasurement(100, i == 0);
+    EXPECT_EQ(autoTuner.willRebuildNeighborLists(), i + 1 == autoTunerInfo.maxSamples) << "Sample " << i;
+    autoTuner.bumpIterationCounters();
+  }
+
+  // The estimate of 300 exceeds 2 x 100, so the speculative configuration is skipped.
+  const auto [lastConf, stillTuningLast] = autoTuner.getNextConfig();
+  EXPECT_TRUE(stillTuningLast);
+  EXPECT_NE(lastConf, firstConf);
+  EXPECT_NE(lastConf, *speculativeConf);
+  EXPECT_EQ(autoTuner.getConfigQueue().size(), 1);
+  EXPECT_EQ(autoTuner.getEvidenceCollection().getEvidence(*speculativeConf), nullptr);
+}
+
 /**
  * Test tuning with two autotuners in combination by checking the return value of `bool stillTuning =
  * LogicHandler::computeInteractionsPipeline()`. The tuners have differently sized search spaces and therefore finish
@@ -976,4 +1361,327 @@ TEST_F(AutoTunerTest, testMultipleTuners) {
     EXPECT_TRUE(logicHandler.computeInteractionsPipeline(&pairFunctor, autopas::InteractionTypeOption::pairwise));
     EXPECT_TRUE(logicHandler.computeInteractionsPipeline(&triFunctor, autopas::InteractionTypeOption::triwise));
   }
-}
\ No newline at end of file
+}
+
+/**
+ * Check that with joint tuning the triwise interactions follow the container of the pairwise tuner while it tunes and
+ * afterwards only tune configurations that share its container.
+ */
+TEST_F(AutoTunerTest, testJointInteractionTuning) {
+  autopas::AutoTuner::TuningStrategiesListType tuningStrategies{};
+  constexpr size_t rebuildFrequency = 3;
+  const autopas::AutoTunerInfo autoTunerInfo{
+      .tuningInterval = 100,
+      .maxSamples = 2,
+  };
+  const autopas::LogicHandlerInfo logicHandlerInfo{
+      .boxMin{0., 0., 0.},
+      .boxMax{10., 10., 10.},
+      .jointInteractionTuning = true,
+  };
+
+  const auto pairwiseSearchSpace = {_confDs_seq_N3, _confLc_c18_N3, _confLc_c08_N3};
+  const auto triwiseSearchSpace = {_confDs_3b_N3, _confLc_c01_3b_noN3};
+
+  std::unordered_map<autopas::InteractionTypeOption::Value, std::unique_ptr<autopas::AutoTuner>> tunerMap;
+  tunerMap.emplace(autopas::InteractionTypeOption::pairwise,
+                   std::make_unique<autopas::AutoTuner>(tuningStrategies, pairwiseSearchSpace, autoTunerInfo,
+                                                        rebuildFrequency, "2B"));
+  tunerMap.emplace(autopas::InteractionTypeOption::triwise,
+                   std::make_unique<autopas::AutoTuner>(tuningStrategies, triwiseSearchSpace, autoTunerInfo,
+                                                        rebuildFrequency, "3B"));
+
+  auto &pairAutoTuner = *tunerMap[autopas::InteractionTypeOption::pairwise];
+  auto &triAutoTuner = *tunerMap[autopas::InteractionTypeOption::triwise];
+
+  autopas::LogicHandler<Molecule> logicHandler(tunerMap, logicHandlerInfo, rebuildFrequency, "");
+
+  testing::NiceMock<MockPairwiseFunctor<Molecule>> pairFunctor;
+  testing::NiceMock<MockTriwiseFunctor<Molecule>> triFunctor;
+
+  EXPECT_CALL(pairFunctor, isRelevantForTuning()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(triFunctor, isRelevantForTuning()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(pairFunctor, allowsNewton3()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(triFunctor, allowsNewton3()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(pairFunctor, allowsNonNewton3()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(triFunctor, allowsNonNewton3()).WillRepeatedly(::testing::Return(true));
+
+  logicHandler.getContainer().addParticle((Molecule{{0.1, 0.1, 0.1}, {0., 0., 0.}, 0, 0}));
+  logicHandler.getContainer().addParticle((Molecule{{0.2, 0.1, 0.1}, {0., 0., 0.}, 1, 0}));
+  logicHandler.getContainer().addParticle((Molecule{{0.1, 0.2, 0.1}, {0., 0., 0.}, 2, 0}));
+
+  // The pairwise tuner samples all its configurations while the triwise interactions stay in the same container.
+  for (size_t i = 0; i < pairwiseSearchSpace.size() * autoTunerInfo.maxSamples; i++) {
+    auto dummyParticlesVec = logicHandler.updateContainer();
+    EXPECT_TRUE(logicHandler.computeInteractionsPipeline(&pairFunctor, autopas::InteractionTypeOption::pairwise));
+    const auto pairwiseContainer = logicHandler.getContainer().getContainerType();
+    EXPECT_FALSE(logicHandler.computeInteractionsPipeline(&triFunctor, autopas::InteractionTypeOption::triwise));
+    EXPECT_EQ(logicHandler.getContainer().getContainerType(), pairwiseContainer) << "Iteration " << i;
+  }
+
+  // Afterwards, only the one triwise configuration that shares the selected container is tuned.
+  for (size_t i = 0; i < autoTunerInfo.maxSamples; i++) {
+    auto dummyParticlesVec = logicHandler.updateContainer();
+    EXPECT_FALSE(logicHandler.computeInteractionsPipeline(&pairFunctor, autopas::InteractionTypeOption::pairwise));
+    EXPECT_TRUE(logicHandler.computeInteractionsPipeline(&triFunctor, autopas::InteractionTypeOption::triwise));
+  }
+  auto dummyParticlesVec = logicHandler.updateContainer();
+  EXPECT_FALSE(logicHandler.computeInteractionsPipeline(&pairFunctor, autopas::InteractionTypeOption::pairwise));
+  EXPECT_FALSE(logicHandler.computeInteractionsPipeline(&triFunctor, autopas::InteractionTypeOption::triwise));
+  // The pairwise samples are only complete once the step is finished in updateContainer().
+  for (const auto &conf : pairwiseSearchSpace) {
+    EXPECT_NE(pairAutoTuner.getEvidenceCollection().getEvidence(conf), nullptr) << conf;
+  }
+  EXPECT_EQ(pairAutoTuner.getCurrentConfig().container, triAutoTuner.getCurrentConfig().container);
+  for (const auto &conf : triwiseSearchSpace) {
+    const auto *evidence = triAutoTuner.getEvidenceCollection().getEvidence(conf);
+    EXPECT_EQ(evidence != nullptr, conf == triAutoTuner.getCurrentConfig()) << conf;
+  }
+}
+
+/**
+ * Check that a slightly faster configuration is only selected if switching to its container pays off before the next
+ * tuning phase.
+ */
+TEST_F(AutoTunerTest, testSwitchCostAwareSelection) {
+  using autopas::ContainerOption;
+  const autopas::AutoTuner::SearchSpaceType searchSpace{_confDs_seq_noN3, _confLc_c08_noN3, _confLc_c01_noN3};
+  const std::map<autopas::Configuration, long> samples{
+      {_confDs_seq_noN3, 98}, {_confLc_c08_noN3, 100}, {_confLc_c01_noN3, 120}};
+  constexpr size_t rebuildFrequency = 1;
+
+  for (const auto &[tuningInterval, expectedConfig] :
+       {std::make_tuple(10u, _confLc_c08_noN3), std::make_tuple(1000u, _confDs_seq_noN3)}) {
+    autopas::AutoTuner::TuningStrategiesListType tuningStrategies{};
+    const autopas::AutoTunerInfo autoTunerInfo{
+        .tuningInterval = tuningInterval,
+        .maxSamples = 1,
+        .useLOESSSmoothening = false,
+        .considerSwitchCosts = true,
+    };
+    autopas::AutoTuner autoTuner{tuningStrategies, searchSpace, autoTunerInfo, rebuildFrequency, ""};
+
+    for (size_t i = 0; i < searchSpace.size(); ++i) {
+      const auto [config, stillTuning] = autoTuner.getNextConfig();
+      EXPECT_TRUE(stillTuning);
+      autoTuner.addMeasurement(samples.at(config), true);
+      autoTuner.bumpIterationCounters();
+    }
+    // Linked cells is active and switching to direct sum costs as much as ten iterations.
+    autoTuner.addContainerSwitchCost(ContainerOption::linkedCells, ContainerOption::directSum, 1000);
+    autoTuner.addContainerSwitchCost(ContainerOption::directSum, ContainerOption::linkedCells, 5);
+    autoTuner.setActiveContainer(ContainerOption::linkedCells);
+
+    EXPECT_EQ(autoTuner.getNextConfig(), std::make_tuple(expectedConfig, false))
+        << "Tuning interval: " << tuningInterval;
+    EXPECT_EQ(autoTuner.getContainerSwitchCosts().size(), 2);
+  }
+}
+
+/**
+ * Check that a container switch is only charged to the tuner whose configuration caused it. The pairwise and triwise
+ * configurations use different containers, so every step switches back and forth.
+ */
+TEST_F(AutoTunerTest, testSwitchCostsChargedToCausingTuner) {
+  using autopas::ContainerOption;
+  autopas::AutoTuner::TuningStrategiesListType tuningStrategies{};
+  constexpr size_t rebuildFrequency = 3;
+  const autopas::AutoTunerInfo autoTunerInfo{
+      .maxSamples = 2,
+  };
+  const autopas::LogicHandlerInfo logicHandlerInfo{
+      .boxMin{0., 0., 0.},
+      .boxMax{10., 10., 10.},
+  };
+
+  const auto pairwiseSearchSpace = {_confLc_c08_N3};
+  const auto triwiseSearchSpace = {_confDs_3b_N3};
+
+  std::unordered_map<autopas::InteractionTypeOption::Value, std::unique_ptr<autopas::AutoTuner>> tunerMap;
+  tunerMap.emplace(autopas::InteractionTypeOption::pairwise,
+                   std::make_unique<autopas::AutoTuner>(tuningStrategies, pairwiseSearchSpace, autoTunerInfo,
+                                                        rebuildFrequency, "2B"));
+  tunerMap.emplace(autopas::InteractionTypeOption::triwise,
+                   std::make_unique<autopas::AutoTuner>(tuningStrategies, triwiseSearchSpace, autoTunerInfo,
+                                                        rebuildFrequency, "3B"));
+  auto &pairAutoTuner = *tunerMap[autopas::InteractionTypeOption::pairwise];
+  auto &triAutoTuner = *tunerMap[autopas::InteractionTypeOption::triwise];
+
+  autopas::LogicHandler<Molecule> logicHandler(tunerMap, logicHandlerInfo, rebuildFrequency, "");
+
+  testing::NiceMock<MockPairwiseFunctor<Molecule>> pairFunctor;
+  testing::NiceMock<MockTriwiseFunctor<Molecule>> triFunctor;
+  EXPECT_CALL(pairFunctor, isRelevantForTuning()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(triFunctor, isRelevantForTuning()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(pairFunctor, allowsNewton3()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(triFunctor, allowsNewton3()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(pairFunctor, allowsNonNewton3()).WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(triFunctor, allowsNonNewton3()).WillRepeatedly(::testing::Return(true));
+
+  logicHandler.getContainer().addParticle((Molecule{{0.1, 0.1, 0.1}, {0., 0., 0.}, 0, 0}));
+  logicHandler.getContainer().addParticle((Molecule{{0.2, 0.1, 0.1}, {0., 0., 0.}, 1, 0}));
+  logicHandler.getContainer().addParticle((Molecule{{0.1, 0.2, 0.1}, {0., 0., 0.}, 2, 0}));
+
+  for (int i = 0; i < 3; i++) {
+    auto dummyParticlesVec = logicHandler.updateContainer();
+    logicHandler.computeInteractionsPipeline(&pairFunctor, autopas::InteractionTypeOption::pairwise);
+    logicHandler.computeInteractionsPipeline(&triFunctor, autopas::InteractionTypeOption::triwise);
+  }
+
+  const auto &pairCosts = pairAutoTuner.getContainerSwitchCosts();
+  const auto &triCosts = triAutoTuner.getContainerSwitchCosts();
+  ASSERT_EQ(pairCosts.size(), 1);
+  const std::pair<ContainerOption, ContainerOption> dsToLc{ContainerOption::directSum, ContainerOption::linkedCells};
+  EXPECT_EQ(pairCosts.begin()->first, dsToLc);
+  ASSERT_EQ(triCosts.size(), 1);
+  const std::pair<ContainerOption, ContainerOption> lcToDs{ContainerOption::linkedCells, ContainerOption::directSum};
+  EXPECT_EQ(triCosts.begin()->first, lcToDs);
+}
+
+#ifdef AUTOPAS_USE_OPENMP
+/**
+ * Checks that the OpenMP thread count and chunk size of the selected configuration reach the traversal's loops:
+ * lc_sliced has to run its dynamically scheduled slice loop with both values and lc_sliced_balanced has to cut as many
+ * slices as the configuration has threads.
+ */
+TEST_F(AutoTunerTest, testThreadCountAndChunkSizeReachTraversal) {
+  using namespace autopas;
+  constexpr unsigned int threadCount = 2;
+  constexpr unsigned int chunkSize = 3;
+  constexpr unsigned int rebuildFrequency = 10;
+  const LogicHandlerInfo logicHandlerInfo{
+      .boxMin{0., 0., 0.},
+      .boxMax{10., 10., 10.},
+  };
+  const Configuration confSliced{ContainerOption::linkedCells,
+                                 1.,
+                                 TraversalOption::lc_sliced,
+                                 LoadEstimatorOption::none,
+                                 DataLayoutOption::aos,
+                                 Newton3Option::enabled,
+                                 InteractionTypeOption::pairwise,
+                                 0,
+                                 threadCount,
+                                 chunkSize};
+  const Configuration confSlicedBalanced{ContainerOption::linkedCells,
+                                         1.,
+                                         TraversalOption::lc_sliced_balanced,
+                                         LoadEstimatorOption::squaredParticlesPerCell,
+                                         DataLayoutOption::aos,
+                                         Newton3Option::enabled,
+                                         InteractionTypeOption::pairwise,
+                                         0,
+                                         threadCount};
+
+  for (const auto &conf : {confSliced, confSlicedBalanced}) {
+    AutoTuner::TuningStrategiesListType tuningStrategies{};
+    std::unordered_map<InteractionTypeOption::Value, std::unique_ptr<AutoTuner>> tunerMap;
+    tunerMap.emplace(InteractionTypeOption::pairwise,
+                     std::make_unique<AutoTuner>(tuningStrategies, std::set<Configuration>{conf}, AutoTunerInfo{},
+                                                 rebuildFrequency, ""));
+    LogicHandler<Molecule> logicHandler(tunerMap, logicHandlerInfo, rebuildFrequency, "");
+
+    // Fill every cell so that every slice has work.
+    size_t id{0};
+    for (double x = 0.5; x < 10.; x += 1.) {
+      for (double y = 0.5; y < 10.; y += 1.) {
+        for (double z = 0.5; z < 10.; z += 1.) {
+          logicHandler.getContainer().addParticle(Molecule{{x, y, z}, {0., 0., 0.}, id++, 0});
+        }
+      }
+    }
+
+    std::set<int> teamSizes{};
+    std::set<int> threadIds{};
+    std::set<std::pair<omp_sched_t, int>> schedules{};
+    testing::NiceMock<MockPairwiseFunctor<Molecule>> functor;
+    EXPECT_CALL(functor, isRelevantForTuning()).WillRepeatedly(::testing::Return(true));
+    EXPECT_CALL(functor, allowsNewton3()).WillRepeatedly(::testing::Return(true));
+    EXPECT_CALL(functor, allowsNonNewton3()).WillRepeatedly(::testing::Return(true));
+    EXPECT_CALL(functor, AoSFunctor(_, _, _)).WillRepeatedly(testing::InvokeWithoutArgs([&]() {
+      omp_sched_t kind{};
+      int chunk{};
+      omp_get_schedule(&kind, &chunk);
+      AUTOPAS_OPENMP(critical) {
+        teamSizes.insert(omp_get_num_threads());
+        threadIds.insert(omp_get_thread_num());
+        schedules.insert({kind, chunk});
+      }
+    }));
+
+    auto dummyParticlesVec = logicHandler.updateContainer();
+    logicHandler.computeInteractionsPipeline(&functor, InteractionTypeOption::pairwise);
+
+    EXPECT_EQ(teamSizes, std::set<int>{threadCount}) << conf.toShortString();
+    if (conf.traversal == TraversalOption::lc_sliced) {
+      const std::set<std::pair<omp_sched_t, int>> expectedSchedules{{omp_sched_dynamic, chunkSize}};
+      EXPECT_EQ(schedules, expectedSchedules);
+    } else {
+      // One slice per thread, and each slice is processed by a different thread.
+      EXPECT_EQ(threadIds, (std::set<int>{0, 1}));
+    }
+  }
+}
+
+/**
+ * With thread team sampling, the first step of a candidate is repeated after the speculative sample. The repetition has
+ * to rebuild the neighbor lists like the speculative step did, so every candidate still gets a rebuild sample.
+ */
+TEST_F(AutoTunerTest, testThreadTeamSamplingKeepsRebuildSamples) {
+  using namespace autopas;
+  NumThreadGuard numThreadGuard(2);
+  constexpr unsigned int rebuildFrequency = 10;
+  const LogicHandlerInfo logicHandlerInfo{
+      .boxMin{0., 0., 0.},
+      .boxMax{10., 10., 10.},
+      .tuningThreadTeams = true,
+  };
+  // A finite early stopping factor enables speculative samples, but none of the candidates is skipped.
+  const AutoTunerInfo autoTunerInfo{
+      .maxSamples = 2,
+      .useLOESSSmoothening = false,
+      .earlyStoppingFactor = 1e6,
+  };
+  AutoTuner::TuningStrategiesListType tuningStrategies{};
+  std::unordered_map<InteractionTypeOption::Value, std::unique_ptr<AutoTuner>> tunerMap;
+  const AutoTuner::SearchSpaceType searchSpace{_confLc_c08_N3, _confLc_c08_noN3};
+  tunerMap.emplace(InteractionTypeOption::pairwise,
+                   std::make_unique<AutoTuner>(tuningStrategies, searchSpace, autoTunerInfo, rebuildFrequency, ""));
+  auto &autoTuner = *tunerMap[InteractionTypeOption::pairwise];
+  LogicHandler<Molecule> logicHandler(tunerMap, logicHandlerInfo, rebuildFrequency, "");
+  size_t id{0};
+  for (double x = 0.5; x < 10.; x += 1.) {
+    for (double y = 0.5; y < 10.; y += 1.) {
+      logicHandler.getContainer().addParticle(Molecule{{x, y, 5.}, {0., 0., 0.}, id++, 0});
+    }
+  }
+
+  // The functor of the second team is a copy, so a copyable functor is needed.
+  LJFunctorGlobals functor(logicHandlerInfo.cutoff);
+  functor.setParticleProperties(24.0, 1);
+
+  // Which steps of each configuration rebuilt the neighbor lists.
+  std::map<Configuration, std::vector<bool>> rebuildsPerConfiguration{};
+  size_t numTuningSteps = 0;
+  while (numTuningSteps < 10) {
+    auto dummyParticlesVec = logicHandler.updateContainer();
+    // The step counter is reset to zero and then incremented in iterations that rebuild the lists.
+    const bool rebuilds = logicHandler.getContainer().getStepsSinceLastRebuild() == 1;
+    if (not logicHandler.computeInteractionsPipeline(&functor, InteractionTypeOption::pairwise)) {
+      break;
+    }
+    rebuildsPerConfiguration[autoTuner.getCurrentConfig()].push_back(rebuilds);
+    ++numTuningSteps;
+  }
+
+  // One extra step for the speculative sample of the first candidate.
+  EXPECT_EQ(numTuningSteps, searchSpace.size() * autoTunerInfo.maxSamples + 1);
+  const std::vector<bool> expectedSampleRebuilds{true, false};
+  for (const auto &[configuration, rebuilds] : rebuildsPerConfiguration) {
+    ASSERT_GE(rebuilds.size(), autoTunerInfo.maxSamples) << configuration.toShortString();
+    // Only the last maxSamples steps of a configuration are samples.
+    const std::vector<bool> sampleRebuilds(rebuilds.end() - autoTunerInfo.maxSamples, rebuilds.end());
+    EXPECT_EQ(sampleRebuilds, expectedSampleRebuilds) << configuration.toShortString();
+  }
+}
+#endif
@@ -6,6 +6,8 @@
 
 #include "ContainerSelectorTest.h"
 
+#include <vector>
+
 TEST_F(ContainerSelectorTest, testSelectAndGetCurrentContainer) {
   autopas::ContainerSelector<Particle> containerSelector(bBoxMin, bBoxMax, cutoff);
   autopas::ContainerSelectorInfo containerInfo(cellSizeFactor, verletSkinPerTimestep, verletRebuildFrequency, 64,
@@ -20,4 +22,185 @@ TEST_F(ContainerSelectorTest, testSelectAndGetCurrentContainer) {
 
     EXPECT_EQ(containerOp, containerSelector.getCurrentContainer().getContainerType());
   }
-}
\ No newline at end of file
+}
+
+/**
+ * Convert between all pairs of container types and check that every owned and every halo particle arrives exactly
+ * once and keeps its ownership. This includes the Octree, which serializes the insertion of particles with a lock.
+ */
+TEST_F(ContainerSelectorTest, testContainerConversion) {
+  autopas::ContainerSelectorInfo containerInfo(cellSizeFactor, verletSkinPerTimestep, verletRebuildFrequency, 64,
+                                               autopas::LoadEstimatorOption::none);
+  // Halo particles are placed in a layer thinner than the interaction length of 1.1 around the box.
+  const std::array<double, 2> haloCoordinates{bBoxMin[0] - 0.5, bBoxMax[0] + 0.5};
+
+  for (const auto from : autopas::ContainerOption::getAllOptions()) {
+    for (const auto to : autopas::ContainerOption::getAllOptions()) {
+      autopas::ContainerSelector<Particle> containerSelector(bBoxMin, bBoxMax, cutoff);
+      containerSelector.selectContainer(from, containerInfo);
+      auto &fromContainer = containerSelector.getCurrentContainer();
+
+      size_t id = 0;
+      for (double x = 0.5; x < bBoxMax[0]; x += 1.) {
+        for (double y = 0.5; y < bBoxMax[1]; y += 1.) {
+          for (double z = 0.5; z < bBoxMax[2]; z += 1.) {
+            fromContainer.addParticle(Particle({x, y, z}, {0., 0., 0.}, id++));
+          }
+        }
+      }
+      const auto numOwned = id;
+      for (const auto x : haloCoordinates) {
+        for (double y = 0.5; y < bBoxMax[1]; y += 1.) {
+          for (double z = 0.5; z < bBoxMax[2]; z += 1.) {
+            Particle haloParticle({x, y, z}, {0., 0., 0.}, id++);
+            haloParticle.setOwnershipState(autopas::OwnershipState::halo);
+            fromContainer.addHaloParticle(haloParticle);
+          }
+        }
+      }
+      const auto numParticles = id;
+
+      containerSelector.selectContainer(to, containerInfo);
+      auto &toContainer = containerSelector.getCurrentContainer();
+      ASSERT_EQ(toContainer.getContainerType(), to);
+
+      std::vector<size_t> numArrivals(numParticles, 0);
+      for (auto iter = toContainer.begin(autopas::IteratorBehavior::ownedOrHalo); iter.isValid(); ++iter) {
+        ASSERT_LT(iter->getID(), numParticles) << from << " -> " << to;
+        ++numArrivals[iter->getID()];
+        EXPECT_EQ(iter->isOwned(), iter->getID() < numOwned)
+            << from << " -> " << to << ": Particle " << iter->getID() << " changed its ownership.";
+      }
+      for (size_t i = 0; i < numParticles; ++i) {
+        EXPECT_EQ(numArrivals[i], 1) << from << " -> " << to << ": Particle " << i << " arrived " << numArrivals[i]
+                                     << " times.";
+      }
+    }
+  }
+}
+
+/**
+ * Fill a container with a regular grid of particles and check that the container for a subdomain contains copies of
+ * the particles inside as owned and of those within the interaction length around it as halo particles.
+ */
+TEST_F(ContainerSelectorTest, testGenerateSubdomainContainer) {
+  autopas::ContainerSelector<Particle> containerSelector(bBoxMin, bBoxMax, cutoff);
+  autopas::ContainerSelectorInfo containerInfo(cellSizeFactor, verletSkinPerTimestep, verletRebuildFrequency, 64,
+                                               autopas::LoadEstimatorOption::none);
+  containerSelector.selectContainer(autopas::ContainerOption::linkedCells, containerInfo);
+
+  auto &container = containerSelector.getCurrentContainer();
+  size_t id = 0;
+  for (double x = 0.5; x < bBoxMax[0]; x += 1.) {
+    for (double y = 0.5; y < bBoxMax[1]; y += 1.) {
+      for (double z = 0.5; z < bBoxMax[2]; z += 1.) {
+        container.addParticle(Particle({x, y, z}, {0., 0., 0.}, id++));
+      }
+    }
+  }
+
+  // interaction length is 1.1 so the halo region covers one layer of particles around the subdomain.
+  const auto subdomainContainer = containerSelector.generateSubdomainContainer(
+      autopas::ContainerOption::verletLists, containerInfo, {4., 4., 4.}, {6., 6., 6.});
+
+  EXPECT_EQ(subdomainContainer->getContainerType(), autopas::ContainerOption::verletLists);
+  EXPECT_EQ(subdomainContainer->getNumberOfParticles(autopas::IteratorBehavior::owned), 2 * 2 * 2);
+  EXPECT_EQ(subdomainContainer->getNumberOfParticles(autopas::IteratorBehavior::halo), 4 * 4 * 4 - 2 * 2 * 2);
+  // the original container is untouched
+  EXPECT_EQ(containerSelector.getCurrentContainer().getContainerType(), autopas::ContainerOption::linkedCells);
+  EXPECT_EQ(containerSelector.getCurrentContainer().getNumberOfParticles(autopas::IteratorBehavior::owned), id);
+}
+
+/**
+ * Switch back and forth between containers with shadow containers enabled and check that the shadows are reused, keep
+ * all particles consistent, and are evicted according to their number and memory budget.
+ */
+TEST_F(ContainerSelectorTest, testShadowContainers) {
+  autopas::ContainerSelector<Particle> containerSelector(bBoxMin, bBoxMax, cutoff);
+  autopas::ContainerSelectorInfo containerInfo(cellSizeFactor, verletSkinPerTimestep, verletRebuildFrequency, 64,
+                                               autopas::LoadEstimatorOption::none);
+  containerSelector.setShadowContainers(1, std::numeric_limits<size_t>::max());
+  containerSelector.selectContainer(autopas::ContainerOption::linkedCells, containerInfo);
+
+  constexpr size_t numParticles = 100;
+  for (size_t id = 0; id < numParticles; ++id) {
+    const auto pos = static_cast<double>(id) / numParticles * bBoxMax[0];
+    containerSelector.getCurrentContainer().addParticle(Particle({pos, pos, pos}, {0., 0., 0.}, id));
+  }
+
+  containerSelector.selectContainer(autopas::ContainerOption::directSum, containerInfo);
+  EXPECT_EQ(containerSelector.getNumShadowContainers(), 1);
+  const auto *linkedCellsShadow = [&]() {
+    containerSelector.selectContainer(autopas::ContainerOption::linkedCells, containerInfo);
+    return &containerSelector.getCurrentContainer();
+  }();
+  // The direct sum container is now the only shadow. Move one particle to see that the reused container is updated.
+  containerSelector.selectContainer(autopas::ContainerOption::directSum, containerInfo);
+  containerSelector.getCurrentContainer().begin()->setF({1., 0., 0.});
+  containerSelector.selectContainer(autopas::ContainerOption::linkedCells, containerInfo);
+  EXPECT_EQ(&containerSelector.getCurrentContainer(), linkedCellsShadow) << "The shadow container was not reused.";
+  EXPECT_EQ(containerSelector.getCurrentContainer().getNumberOfParticles(), numParticles);
+  size_t numForcedParticles = 0;
+  for (auto iter = containerSelector.getCurrentContainer().begin(); iter.isValid(); ++iter) {
+    numForcedParticles += iter->getF()[0] == 1. ? 1 : 0;
+  }
+  EXPECT_EQ(numForcedParticles, 1);
+
+  // A shadow that does not fit into the memory budget is not kept.
+  containerSelector.setShadowContainers(1, sizeof(Particle) * numParticles / 2);
+  EXPECT_EQ(containerSelector.getNumShadowContainers(), 0);
+  containerSelector.selectContainer(autopas::ContainerOption::directSum, containerInfo);
+  EXPECT_EQ(containerSelector.getNumShadowContainers(), 0);
+}
+
+/**
+ * The memory estimate of a container has to cover more than its particles: cells and, for Verlet lists, neighbor lists.
+ * Shadows are budgeted with this estimate.
+ */
+TEST_F(ContainerSelectorTest, testMemoryEstimate) {
+  autopas::ContainerSelector<Particle> containerSelector(bBoxMin, bBoxMax, cutoff);
+  autopas::ContainerSelectorInfo containerInfo(cellSizeFactor, verletSkinPerTimestep, verletRebuildFrequency, 64,
+                                               autopas::LoadEstimatorOption::none);
+  containerSelector.setShadowContainers(1, std::numeric_limits<size_t>::max());
+  containerSelector.selectContainer(autopas::ContainerOption::linkedCells, containerInfo);
+
+  constexpr size_t numParticles = 1000;
+  for (size_t id = 0; id < numParticles; ++id) {
+    const auto pos = static_cast<double>(id) / numParticles * bBoxMax[0];
+    containerSelector.getCurrentContainer().addParticle(Particle({pos, pos, pos}, {0., 0., 0.}, id));
+  }
+  const auto linkedCellsEstimate = containerSelector.getCurrentContainer().getMemoryEstimate();
+  EXPECT_GT(linkedCellsEstimate, numParticles * sizeof(Particle));
+
+  containerSelector.selectContainer(autopas::ContainerOption::verletLists, containerInfo);
+  const auto verletListsEstimate = containerSelector.getCurrentContainer().getMemoryEstimate();
+  EXPECT_GT(verletListsEstimate, linkedCellsEstimate) << "Neighbor lists are not part of the estimate.";
+
+  // The linked cells shadow does not fit into a budget that only covers its particles.
+  EXPECT_EQ(containerSelector.getNumShadowContainers(), 1);
+  containerSelector.setShadowContainers(1, numParticles * sizeof(Particle));
+  EXPECT_EQ(containerSelector.getNumShadowContainers(), 0);
+}
+
+/**
+ * A shadow container must not be reused for an info that only differs in the rebuild frequency because its skin
+ * would not match.
+ */
+TEST_F(ContainerSelectorTest, testShadowContainerRequiresMatchingSkin) {
+  autopas::ContainerSelector<Particle> containerSelector(bBoxMin, bBoxMax, cutoff);
+  const autopas::ContainerSelectorInfo containerInfo(cellSizeFactor, verletSkinPerTimestep, verletRebuildFrequency,
+                                                     64, autopas::LoadEstimatorOption::none);
+  const autopas::ContainerSelectorInfo containerInfoDoubleFrequency(
+      cellSizeFactor, verletSkinPerTimestep, 2 * verletRebuildFrequency, 64, autopas::LoadEstimatorOption::none);
+  containerSelector.setShadowContainers(2, std::numeric_limits<size_t>::max());
+
+  containerSelector.selectContainer(autopas::ContainerOption::linkedCells, containerInfo);
+  const auto *linkedCells = &containerSelector.getCurrentContainer();
+  containerSelector.selectContainer(autopas::ContainerOption::directSum, containerInfo);
+  containerSelector.selectContainer(autopas::ContainerOption::linkedCells, containerInfoDoubleFrequency);
+
+  EXPECT_NE(&containerSelector.getCurrentContainer(), linkedCells) << "The shadow with the wrong skin was reused.";
+  EXPECT_DOUBLE_EQ(containerSelector.getCurrentContainer().getVerletSkin(),
+                   verletSkinPerTimestep * 2 * verletRebuildFrequency);
+  EXPECT_EQ(containerSelector.getNumShadowContainers(), 2);
+}
@@ -115,6 +115,36 @@ TEST_F(GaussianProcessTest, clear) {
   EXPECT_NEAR(gp.predictVar(f2), 0., epsilon);
 }
 
+/**
+ * Add more evidence than the GaussianProcess keeps and check that the incrementally updated hyperparameters match
+ * the ones calculated from scratch on the remaining evidence.
+ */
+TEST_F(GaussianProcessTest, incrementalUpdateWithWindow) {
+  Random rng(32);
+
+  constexpr double sigma = 0.001;  // noise
+  constexpr size_t maxEvidence = 10;
+  GaussianProcess gp(1, sigma, rng, maxEvidence);
+
+  // Fix the output range first so that most later evidence does not trigger a resampling.
+  // With this sequence the last four evidence, including the last one, are added incrementally.
+  gp.addEvidence(utils::Math::makeVectorXd({0.}), -1., true);
+  gp.addEvidence(utils::Math::makeVectorXd({1.}), 1., true);
+  for (size_t i = 2; i < 2 * maxEvidence + 3; ++i) {
+    const double x = std::fmod(i * 0.37, 5.);
+    gp.addEvidence(utils::Math::makeVectorXd({x}), std::sin(x), true);
+  }
+
+  ASSERT_EQ(gp.numEvidence(), maxEvidence);
+  const auto [inputs, outputs] = gp.getEvidence();
+  for (const auto &hyper : gp.getHyperparameters()) {
+    auto expected = hyper;
+    expected.precalculate(sigma, inputs, outputs);
+    EXPECT_TRUE(hyper.covMatL.isApprox(expected.covMatL, 1e-8));
+    EXPECT_TRUE(hyper.weights.isApprox(expected.weights, 1e-6));
+  }
+}
+
 TEST_F(GaussianProcessTest, sine) {
   Random rng(42);
 
@@ -0,0 +1,100 @@
+/**
+ * @file RegressionCostModelTest.cpp
+ * @date 18.10.26
+ */
+
+#include "RegressionCostModelTest.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include "autopas/tuning/tuningStrategy/RegressionCostModel.h"
+#include "autopas/tuning/tuningStrategy/TuningLogEntry.h"
+
+namespace {
+/**
+ * Creates a LiveInfo that only contains the number of particles.
+ */
+autopas::LiveInfo makeLiveInfo(size_t numParticles) {
+  // Index of size_t in LiveInfo::InfoType
+  constexpr size_t sizeTIdx = 2;
+  std::stringstream stream;
+  stream << "1 numParticles " << sizeTIdx << ' ' << numParticles;
+  autopas::LiveInfo liveInfo;
+  stream >> liveInfo;
+  return liveInfo;
+}
+
+const autopas::Configuration confA{autopas::ContainerOption::linkedCells,   1.,
+                                   autopas::TraversalOption::lc_c08,        autopas::LoadEstimatorOption::none,
+                                   autopas::DataLayoutOption::aos,          autopas::Newton3Option::enabled,
+                                   autopas::InteractionTypeOption::pairwise};
+const autopas::Configuration confB{autopas::ContainerOption::linkedCells,   1.,
+                                   autopas::TraversalOption::lc_c08,        autopas::LoadEstimatorOption::none,
+                                   autopas::DataLayoutOption::soa,          autopas::Newton3Option::enabled,
+                                   autopas::InteractionTypeOption::pairwise};
+const autopas::Configuration confC{autopas::ContainerOption::directSum,     1.,
+                                   autopas::TraversalOption::ds_sequential, autopas::LoadEstimatorOption::none,
+                                   autopas::DataLayoutOption::aos,          autopas::Newton3Option::disabled,
+                                   autopas::InteractionTypeOption::pairwise};
+const autopas::Configuration confD{autopas::ContainerOption::verletClusterLists, 1.,
+                                   autopas::TraversalOption::vcl_c06,           autopas::LoadEstimatorOption::none,
+                                   autopas::DataLayoutOption::soa,              autopas::Newton3Option::disabled,
+                                   autopas::InteractionTypeOption::pairwise};
+}  // namespace
+
+/**
+ * Train with runtimes that scale linearly with the number of particles and check that the model extrapolates to a
+ * larger scenario, ranks the queue by its predictions and prunes hopeless configurations but not unknown ones.
+ */
+TEST_F(RegressionCostModelTest, testExtrapolateAndRank) {
+  autopas::RegressionCostModel model(autopas::InteractionTypeOption::pairwise, 3., "");
+  for (const size_t numParticles : {1000ul, 2000ul, 4000ul, 8000ul}) {
+    const auto liveInfo = makeLiveInfo(numParticles);
+    model.train(liveInfo, confA, 10 * numParticles);
+    model.train(liveInfo, confB, 2 * numParticles);
+    model.train(liveInfo, confC, 100 * numParticles);
+  }
+  EXPECT_EQ(model.getNumTrainingSamples(), 12);
+
+  const auto largeScenario = makeLiveInfo(16000);
+  const auto predictionB = model.predict(largeScenario, confB);
+  ASSERT_TRUE(predictionB.has_value());
+  EXPECT_NEAR(*predictionB, 2 * 16000, 0.05 * 2 * 16000);
+  EXPECT_FALSE(model.predict(largeScenario, confD).has_value()) << "VerletClusterLists were never observed.";
+
+  model.receiveLiveInfo(largeScenario);
+  std::vector<autopas::Configuration> queue{confB, confD, confA, confC};
+  model.reset(0, 0, queue, {});
+  // confB is tested first, confA and confC are predicted to be more than three times slower, confD is unknown
+  EXPECT_EQ(queue, (std::vector<autopas::Configuration>{confD, confB}));
+}
+
+/**
+ * Write a tuning log in the format of TuningStrategyLogger and train a model with it.
+ */
+TEST_F(RegressionCostModelTest, testTrainFromTuningLog) {
+  const auto logFile = (std::filesystem::temp_directory_path() / "autopasRegressionCostModelTest.txt").string();
+  {
+    std::ofstream out{logFile};
+    out << autopas::tuningLogEntry::writeReset(0) << std::endl;
+    // evidence without preceding live info can not be used
+    out << autopas::tuningLogEntry::writeEvidence(100, 0, confA) << std::endl;
+    out << autopas::tuningLogEntry::writeLiveInfo(makeLiveInfo(1000)) << std::endl;
+    out << autopas::tuningLogEntry::writeEvidence(100, 1, confA) << std::endl;
+    out << autopas::tuningLogEntry::writeEvidence(20, 2, confB) << std::endl;
+    out << autopas::tuningLogEntry::writeTune() << std::endl;
+  }
+
+  autopas::RegressionCostModel model(autopas::InteractionTypeOption::pairwise, 3., logFile);
+  EXPECT_EQ(model.getNumTrainingSamples(), 2);
+  const auto predictionA = model.predict(makeLiveInfo(1000), confA);
+  const auto predictionB = model.predict(makeLiveInfo(1000), confB);
+  ASSERT_TRUE(predictionA.has_value());
+  ASSERT_TRUE(predictionB.has_value());
+  EXPECT_GT(*predictionA, *predictionB);
+
+  std::remove(logFile.c_str());
+}
@@ -0,0 +1,124 @@
+/**
+ * @file TuningDatabaseTest.cpp
+ * @date 18.10.26
+ */
+
+#include "TuningDatabaseTest.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <sstream>
+
+#include "autopas/tuning/tuningStrategy/TuningDatabase.h"
+
+namespace {
+/**
+ * Creates a LiveInfo that only contains the features relevant for the TuningDatabase.
+ */
+autopas::LiveInfo makeLiveInfo(double maxDensity, double homogeneity, size_t threadCount) {
+  // Indices of double and size_t in LiveInfo::InfoType
+  constexpr size_t doubleIdx = 1;
+  constexpr size_t sizeTIdx = 2;
+  std::stringstream stream;
+  stream << "5 maxDensity " << doubleIdx << ' ' << maxDensity << " homogeneity " << doubleIdx << ' ' << homogeneity
+         << " particleSize " << sizeTIdx << " 64 threadCount " << sizeTIdx << ' ' << threadCount << " functorTypeHash "
+         << sizeTIdx << " 42";
+  autopas::LiveInfo liveInfo;
+  stream >> liveInfo;
+  return liveInfo;
+}
+
+const autopas::Configuration confA{autopas::ContainerOption::linkedCells,   1.,
+                                   autopas::TraversalOption::lc_c08,        autopas::LoadEstimatorOption::none,
+                                   autopas::DataLayoutOption::aos,          autopas::Newton3Option::enabled,
+                                   autopas::InteractionTypeOption::pairwise};
+const autopas::Configuration confB{autopas::ContainerOption::linkedCells,   1.,
+                                   autopas::TraversalOption::lc_c08,        autopas::LoadEstimatorOption::none,
+                                   autopas::DataLayoutOption::soa,          autopas::Newton3Option::enabled,
+                                   autopas::InteractionTypeOption::pairwise};
+const autopas::Configuration confC{autopas::ContainerOption::directSum,     1.,
+                                   autopas::TraversalOption::ds_sequential, autopas::LoadEstimatorOption::none,
+                                   autopas::DataLayoutOption::aos,          autopas::Newton3Option::disabled,
+                                   autopas::InteractionTypeOption::pairwise, 0,
+                                   2,                                        8};
+}  // namespace
+
+/**
+ * Records one tuning phase, reloads the database from disk and checks warm start, skipping, and that scenarios with
+ * different discrete features are ignored.
+ */
+TEST_F(TuningDatabaseTest, testRecordAndWarmStart) {
+  const auto databaseFile = (std::filesystem::temp_directory_path() / "autopasTuningDatabaseTest.txt").string();
+  std::remove(databaseFile.c_str());
+  const autopas::EvidenceCollection emptyEvidence{};
+
+  {
+    autopas::TuningDatabase database(databaseFile, 0.3, 0.05);
+    database.receiveLiveInfo(makeLiveInfo(1., 0.1, 4));
+    std::vector<autopas::Configuration> queue{confA, confB, confC};
+    database.reset(0, 0, queue, emptyEvidence);
+    EXPECT_EQ(queue, (std::vector<autopas::Configuration>{confA, confB, confC})) << "Empty database changed the queue.";
+    database.addEvidence(confA, {0, 0, 30});
+    database.addEvidence(confB, {1, 0, 10});
+    database.addEvidence(confC, {2, 0, 20});
+    // results are persisted once the tuning phase is complete
+    std::vector<autopas::Configuration> emptyQueue{};
+    database.optimizeSuggestions(emptyQueue, emptyEvidence);
+  }
+
+  autopas::TuningDatabase database(databaseFile, 0.3, 0.05);
+  ASSERT_EQ(database.getEntries().size(), 1);
+  const auto &ranked = database.getEntries().front().rankedConfigurations;
+  ASSERT_EQ(ranked.size(), 3);
+  EXPECT_EQ(ranked[0].first, confB);
+  EXPECT_EQ(ranked[1].first, confC);
+  EXPECT_EQ(ranked[2].first, confA);
+
+  // similar scenario: known configurations are moved to the back of the queue with the best at the very end
+  database.receiveLiveInfo(makeLiveInfo(1.1, 0.1, 4));
+  std::vector<autopas::Configuration> queue{confB, confA, confC};
+  database.reset(1, 1, queue, emptyEvidence);
+  EXPECT_EQ(queue, (std::vector<autopas::Configuration>{confA, confC, confB}));
+
+  // almost identical scenario: tuning is skipped
+  database.receiveLiveInfo(makeLiveInfo(1., 0.1, 4));
+  queue = {confA, confB, confC};
+  database.reset(2, 2, queue, emptyEvidence);
+  EXPECT_EQ(queue, (std::vector<autopas::Configuration>{confB}));
+
+  // different thread count: nothing is known
+  database.receiveLiveInfo(makeLiveInfo(1., 0.1, 8));
+  queue = {confA, confB, confC};
+  database.reset(3, 3, queue, emptyEvidence);
+  EXPECT_EQ(queue, (std::vector<autopas::Configuration>{confA, confB, confC}));
+
+  std::remove(databaseFile.c_str());
+}
+
+/**
+ * Checks that the evidence of a tuning phase that was not completed is neither written to disk nor kept in memory.
+ */
+TEST_F(TuningDatabaseTest, testUnfinishedPhaseIsNotPersisted) {
+  const auto databaseFile =
+      (std::filesystem::temp_directory_path() / "autopasTuningDatabaseTestUnfinished.txt").string();
+  std::remove(databaseFile.c_str());
+  const autopas::EvidenceCollection emptyEvidence{};
+
+  {
+    autopas::TuningDatabase database(databaseFile, 0.3, 0.05);
+    database.receiveLiveInfo(makeLiveInfo(1., 0.1, 4));
+    std::vector<autopas::Configuration> queue{confA, confB, confC};
+    database.reset(0, 0, queue, emptyEvidence);
+    database.addEvidence(confA, {0, 0, 30});
+    queue = {confB, confC};
+    database.optimizeSuggestions(queue, emptyEvidence);
+    EXPECT_TRUE(database.getEntries().empty()) << "The tuning phase is not complete yet.";
+    // the database is destroyed mid phase
+  }
+
+  EXPECT_FALSE(std::filesystem::exists(databaseFile));
+  autopas::TuningDatabase database(databaseFile, 0.3, 0.05);
+  EXPECT_TRUE(database.getEntries().empty());
+
+  std::remove(databaseFile.c_str());
+}
@@ -466,6 +466,42 @@ TEST(FuzzyTuningTest, testMaxDefuzzification) {
   EXPECT_NEAR(unionSet->defuzzify(DefuzzificationMethodOption::MoM, numSamples), 10, 1e-1);
 }
 
+/**
+ * Tests if the prediction of a fuzzy control system, which uses sampled consequents, yields the same value as
+ * defuzzifying the union of the cut consequents. Also checks that adding a rule invalidates the sampled consequents.
+ */
+TEST(FuzzyTuningTest, testPredictMatchesDefuzzifiedUnion) {
+  auto X = LinguisticVariable("x", std::pair(-5, 30));
+  X.addLinguisticTerm(FuzzySetFactory::makeFuzzySet("low", "Triangle", {0, 10, 20}));
+  X.addLinguisticTerm(FuzzySetFactory::makeFuzzySet("high", "Triangle", {15, 25, 30}));
+
+  auto Y = LinguisticVariable("y", std::pair(0, 40));
+  Y.addLinguisticTerm(FuzzySetFactory::makeFuzzySet("low", "Triangle", {0, 10, 20}));
+  Y.addLinguisticTerm(FuzzySetFactory::makeFuzzySet("mid", "Gaussian", {20, 5}));
+  Y.addLinguisticTerm(FuzzySetFactory::makeFuzzySet("high", "Triangle", {20, 30, 40}));
+
+  const size_t numSamples = 500;
+  for (const auto &method : {"centerOfGravity", "meanOfMaximum"}) {
+    auto settings = std::make_shared<FuzzyControlSettings>(FuzzyControlSettings{{"defuzzificationMethod", method}});
+    auto fuzzyController = FuzzyControlSystem(settings);
+    fuzzyController.addRule(FuzzyRule(X == "low", Y == "low"));
+    fuzzyController.addRule(FuzzyRule(X == "high", Y == "high"));
+
+    for (const auto &addThirdRule : {false, true}) {
+      if (addThirdRule) {
+        fuzzyController.addRule(FuzzyRule(not(X == "low"), Y == "mid"));
+      }
+      for (double x = -5; x <= 30; x += 2.5) {
+        const FuzzySet::Data data{{"x", x}};
+        const auto expected = fuzzyController.applyRules(data)->defuzzify(
+            DefuzzificationMethodOption::parseOptionExact(method), numSamples);
+        EXPECT_NEAR(fuzzyController.predict(data, numSamples), expected, 1e-10)
+            << "Method: " << method << " x: " << x << " third rule: " << addThirdRule;
+      }
+    }
+  }
+}
+
 /**
  * Tests if the fuzzy tuning class can parse a rule file and create the correct fuzzy control system.
  * The test uses a simple rule file with one rule and checks if the rule file can be parsed and interpreted correctly.
@@ -7,6 +7,9 @@
 
 #include <gmock/gmock-matchers.h>
 
+#include <algorithm>
+
+#include "autopas/containers/CompatibleTraversals.h"
 #include "autopas/tuning/utils/SearchSpaceGenerators.h"
 #include "autopas/utils/AutoPasConfigurationCommunicator.h"
 
@@ -53,4 +56,48 @@ TEST_F(AutoPasConfigurationCommunicatorTest, SerializationTest) {
 
   EXPECT_GE(maxSearchSpaceSize, triwiseSearchSpace.size());
   testConfigsCommunication(triwiseSearchSpace);
-}
\ No newline at end of file
+
+  // Test configurations with tuned rebuild frequencies
+  const auto rebuildFrequencySearchSpace = autopas::SearchSpaceGenerators::cartesianProduct(
+      containerOptions, pairwiseTraversalOptions, loadEstimatorOptions, dataLayoutOptions, newton3Options,
+      &cellSizeFactors, autopas::InteractionTypeOption::pairwise, {5, 10});
+  EXPECT_EQ(rebuildFrequencySearchSpace.size(), 2 * pairwiseSearchSpace.size());
+  testConfigsCommunication(rebuildFrequencySearchSpace);
+
+  // Test configurations with tuned thread counts and chunk sizes
+  const auto openMPSearchSpace = autopas::SearchSpaceGenerators::cartesianProduct(
+      containerOptions, pairwiseTraversalOptions, loadEstimatorOptions, dataLayoutOptions, newton3Options,
+      &cellSizeFactors, autopas::InteractionTypeOption::pairwise, {0}, {1, 2}, {1, 4, 16});
+  // Only traversals that use a chunk size are crossed with the chunk sizes.
+  const auto chunkSizeTraversals = autopas::compatibleTraversals::allTraversalsSupportingChunkSize();
+  const auto numChunkSizeConfigs =
+      std::count_if(pairwiseSearchSpace.begin(), pairwiseSearchSpace.end(),
+                    [&](const auto &conf) { return chunkSizeTraversals.count(conf.traversal) != 0; });
+  EXPECT_EQ(openMPSearchSpace.size(), 2 * (pairwiseSearchSpace.size() + 2 * numChunkSizeConfigs));
+  for (const auto &conf : openMPSearchSpace) {
+    EXPECT_TRUE(conf.chunkSize != 0 or chunkSizeTraversals.count(conf.traversal) == 0) << conf.toShortString();
+    EXPECT_TRUE(conf.chunkSize == 0 or chunkSizeTraversals.count(conf.traversal) != 0) << conf.toShortString();
+  }
+  testConfigsCommunication(openMPSearchSpace);
+}
+/**
+ * Tests that a configuration and its evidence value survive serialization.
+ */
+TEST_F(AutoPasConfigurationCommunicatorTest, SerializationWithValueTest) {
+  const autopas::Configuration config{autopas::ContainerOption::verletLists,
+                                      1.5,
+                                      autopas::TraversalOption::vl_list_iteration,
+                                      autopas::LoadEstimatorOption::none,
+                                      autopas::DataLayoutOption::soa,
+                                      autopas::Newton3Option::enabled,
+                                      autopas::InteractionTypeOption::pairwise,
+                                      5};
+  for (const long value : {-1l, 0l, 123456789012l}) {
+    const auto serialized =
+        autopas::utils::AutoPasConfigurationCommunicator::serializeConfigurationAndValue(config, value);
+    const auto [configDeserialized, valueDeserialized] =
+        autopas::utils::AutoPasConfigurationCommunicator::deserializeConfigurationAndValue(serialized);
+    EXPECT_EQ(configDeserialized, config);
+    EXPECT_EQ(valueDeserialized, value);
+  }
+}
@@ -0,0 +1,34 @@
+/**
+ * @file CpuFrequencyMeterTest.cpp
+ * @date 18.10.26
+ */
+
+#include "CpuFrequencyMeterTest.h"
+
+#include <cmath>
+
+#include "autopas/utils/CpuFrequencyMeter.h"
+#include "autopas/utils/ExceptionHandler.h"
+
+/**
+ * The frequency is either available and positive between reset() and sample(), or the meter reports that it is not
+ * available.
+ */
+TEST_F(CpuFrequencyMeterTest, testMeasureOrFallBack) {
+  autopas::utils::CpuFrequencyMeter meter;
+  const bool available = meter.init(false);
+
+  meter.reset();
+  meter.sample();
+
+  if (available) {
+    EXPECT_GT(meter.get_mean_frequency(), 0.);
+    EXPECT_GT(meter.get_reference_frequency(), 0.);
+    EXPECT_GE(meter.get_throttle_events(), 0);
+  } else {
+    EXPECT_TRUE(std::isnan(meter.get_mean_frequency()));
+    EXPECT_TRUE(std::isnan(meter.get_reference_frequency()));
+    EXPECT_EQ(meter.get_throttle_events(), 0);
+    EXPECT_THROW(meter.init(true), autopas::utils::ExceptionHandler::AutoPasException);
+  }
+}
@@ -0,0 +1,12 @@
+/**
+ * @file CpuFrequencyMeterTest.h
+ * @date 18.10.26
+ */
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "AutoPasTestBase.h"
+
+class CpuFrequencyMeterTest : public AutoPasTestBase {};
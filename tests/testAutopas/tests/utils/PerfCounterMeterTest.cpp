@@ -0,0 +1,60 @@
+/**
+ * @file PerfCounterMeterTest.cpp
+ * @date 18.10.26
+ */
+
+#include "PerfCounterMeterTest.h"
+
+#include <cmath>
+
+#include "autopas/utils/ExceptionHandler.h"
+#include "autopas/utils/PerfCounterMeter.h"
+
+/**
+ * Counters are either available and count the work between reset() and sample(), or the meter falls back to zeros.
+ */
+TEST_F(PerfCounterMeterTest, testMeasureOrFallBack) {
+  autopas::utils::PerfCounterMeter meter;
+  const bool available = meter.init({});
+
+  meter.reset();
+  volatile double sum = 0.;
+  for (int i = 0; i < 100000; ++i) {
+    sum = sum + i * 0.5;
+  }
+  meter.sample();
+
+  if (available) {
+    EXPECT_GT(meter.get_instructions() + meter.get_cycles() + meter.get_l1_misses() + meter.get_llc_misses(), 0);
+  } else {
+    EXPECT_EQ(meter.get_instructions(), 0);
+    EXPECT_EQ(meter.get_cycles(), 0);
+    EXPECT_EQ(meter.get_l1_misses(), 0);
+    EXPECT_EQ(meter.get_llc_misses(), 0);
+    EXPECT_TRUE(std::isnan(meter.get_ipc()));
+#ifndef AUTOPAS_ENABLE_PERF_COUNTERS
+    EXPECT_THROW(meter.init({autopas::utils::PerfCounterMeter::cycles}),
+                 autopas::utils::ExceptionHandler::AutoPasException);
+#endif
+  }
+}
+
+/**
+ * Requiring an event must throw exactly if this event is not available, independent of the other events.
+ */
+TEST_F(PerfCounterMeterTest, testRequiredEventMustBeAvailable) {
+  using autopas::utils::PerfCounterMeter;
+  for (const auto event : {PerfCounterMeter::instructions, PerfCounterMeter::cycles, PerfCounterMeter::l1Misses,
+                           PerfCounterMeter::llcMisses}) {
+    PerfCounterMeter probe;
+    probe.init({});
+    const bool eventAvailable = probe.isAvailable(event);
+
+    PerfCounterMeter meter;
+    if (eventAvailable) {
+      EXPECT_NO_THROW(meter.init({event})) << "Event " << event;
+    } else {
+      EXPECT_THROW(meter.init({event}), autopas::utils::ExceptionHandler::AutoPasException) << "Event " << event;
+    }
+  }
+}
@@ -0,0 +1,12 @@
+/**
+ * @file PerfCounterMeterTest.h
+ * @date 18.10.26
+ */
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "AutoPasTestBase.h"
+
+class PerfCounterMeterTest : public AutoPasTestBase {};
@@ -355,4 +355,48 @@ TEST_F(SoATest, SoATestComplicatedAccess) {
   EXPECT_EQ(res[0], 7.);
   EXPECT_EQ(res[1], 8.);
   EXPECT_EQ(res[2], 9.);
-}
\ No newline at end of file
+}
+
+TEST_F(SoATest, SoATestPartialResize) {
+  // default soa using autopas::Particle
+  using autopas::Particle;
+  autopas::SoA<Particle::SoAArraysType> soa;
+
+  soa.resizeArrays(5);
+  soa.resizeArrays<Particle::AttributeNames::posX, Particle::AttributeNames::forceX>(3);
+
+  EXPECT_EQ(soa.size(), 3);
+  soa.begin<Particle::AttributeNames::posX>()[2] = 4.2;
+  EXPECT_EQ(soa.read<Particle::AttributeNames::posX>(2), 4.2);
+  EXPECT_EQ(soa.readMultiple<Particle::AttributeNames::forceX>(2)[0], 0.);
+  // arrays that were not requested are emptied
+  EXPECT_THROW(soa.read<Particle::AttributeNames::posY>(0), std::out_of_range);
+  EXPECT_TRUE(soa.isLoaded<Particle::AttributeNames::posX>());
+  EXPECT_FALSE(soa.isLoaded<Particle::AttributeNames::posY>());
+}
+
+/**
+ * Appending partially loaded SoAs and views of them only appends the loaded arrays. Mixing SoAs with different loaded
+ * arrays is an error.
+ */
+TEST_F(SoATest, SoATestAppendPartiallyLoaded) {
+  using autopas::Particle;
+  autopas::SoA<Particle::SoAArraysType> source;
+  source.resizeArrays<Particle::AttributeNames::posX>(4);
+  for (size_t i = 0; i < source.size(); ++i) {
+    source.write<Particle::AttributeNames::posX>(i, static_cast<double>(i));
+  }
+
+  autopas::SoA<Particle::SoAArraysType> target;
+  target.append(source);
+  target.append(source.constructView(1, 3));
+  EXPECT_EQ(target.size(), 6);
+  EXPECT_FALSE(target.isLoaded<Particle::AttributeNames::posY>());
+  EXPECT_EQ(target.read<Particle::AttributeNames::posX>(3), 3.);
+  EXPECT_EQ(target.read<Particle::AttributeNames::posX>(4), 1.);
+  EXPECT_EQ(target.read<Particle::AttributeNames::posX>(5), 2.);
+
+  autopas::SoA<Particle::SoAArraysType> fullyLoaded;
+  fullyLoaded.resizeArrays(2);
+  EXPECT_THROW(fullyLoaded.append(source), autopas::utils::ExceptionHandler::AutoPasException);
+}